@@ -0,0 +1,53 @@
+ifndef VERBOSE
+.SILENT:
+endif
+
+.DEFAULT_GOAL := all
+
+# Unlike tests, benchmarks are only meaningful with optimizations on
+OPT = 2
+
+include paths.mk
+include $(BUILDDEFS_PATH)/message.mk
+
+TARGET=bench/$(BENCH)
+
+BENCH_OBJ = $(BUILD_DIR)/bench_obj
+
+OUTPUTS := $(BENCH_OBJ)/$(BENCH)
+
+CREATE_MAP := no
+
+VPATH += \
+	$(COMMON_VPATH) \
+	$(BENCH_PATH)
+
+all: elf
+
+PLATFORM:=TEST
+PLATFORM_KEY:=test
+BOOTLOADER_TYPE:=none
+CUSTOM_MATRIX:=lite
+
+# Benchmarks of whole features enable them the same way a keyboard would
+include $(BENCH_PATH)/rules.mk
+$(foreach AFEATURE,$($(BENCH)_FEATURES),$(eval $(AFEATURE)_ENABLE := yes))
+
+include $(BUILDDEFS_PATH)/common_features.mk
+include $(BUILDDEFS_PATH)/generic_features.mk
+include $(PLATFORM_PATH)/common.mk
+include $(TMK_PATH)/protocol.mk
+
+$(BENCH)_SRC += $(BENCH_PATH)/bench.c
+$(BENCH)_DEFS += -DBENCH_SUITE_NAME=\"$(BENCH)\"
+
+$(BENCH_OBJ)/$(BENCH)_SRC := $($(BENCH)_SRC)
+$(BENCH_OBJ)/$(BENCH)_INC := $($(BENCH)_INC) $(VPATH)
+$(BENCH_OBJ)/$(BENCH)_DEFS := $($(BENCH)_DEFS)
+$(BENCH_OBJ)/$(BENCH)_CONFIG := $($(BENCH)_CONFIG)
+
+include $(PLATFORM_PATH)/$(PLATFORM_KEY)/platform.mk
+include $(BUILDDEFS_PATH)/common_rules.mk
+
+$(shell mkdir -p $(BUILD_DIR)/bench 2>/dev/null)
+$(shell mkdir -p $(BENCH_OBJ) 2>/dev/null)
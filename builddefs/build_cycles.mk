@@ -0,0 +1,11 @@
+# Builds the keyboard's firmware with a main loop counting the cycles spent in
+# its hot paths, to be run under an emulator. See docs/unit_testing.md.
+
+ifneq ($(strip $(PLATFORM_KEY)), chibios)
+    $(call CATASTROPHIC_ERROR,Invalid platform,Counting cycles is only supported on ChibiOS keyboards)
+endif
+
+SRC += $(PLATFORM_PATH)/$(PLATFORM_KEY)/cycles.c
+
+# There is no peer to talk to under an emulator
+SPLIT_KEYBOARD := no
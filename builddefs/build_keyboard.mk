@@ -43,6 +43,16 @@ ifneq ($(CONVERT_TO),)
     override TARGET := $(TARGET)_$(CONVERT_TO)
 endif
 
+# Host simulator builds are kept apart from the firmware
+ifneq ($(filter sim,$(MAKECMDGOALS)),)
+    SIM_BUILD := yes
+    override TARGET := $(TARGET)_sim
+endif
+ifneq ($(filter cycles,$(MAKECMDGOALS)),)
+    CYCLES_BUILD := yes
+    override TARGET := $(TARGET)_cycles
+endif
+
 # Object files and generated keymap directory
 #     To put object files in current directory, use a dot (.), do NOT make
 #     this an empty or blank macro!
@@ -255,7 +265,12 @@ $(INTERMEDIATE_OUTPUT)/src/keymap.h: $(KEYMAP_JSON) $(DD_CONFIG_FILES)
 	$(eval CMD=$(QMK_BIN) generate-keymap-h --quiet --output $(INTERMEDIATE_OUTPUT)/src/keymap.h $(KEYMAP_JSON))
 	@$(BUILD_CMD)
 
-generated-files: $(INTERMEDIATE_OUTPUT)/src/config.h $(INTERMEDIATE_OUTPUT)/src/keymap.c $(INTERMEDIATE_OUTPUT)/src/keymap.h
+$(INTERMEDIATE_OUTPUT)/src/leader_sequences.h: $(KEYMAP_JSON) $(DD_CONFIG_FILES)
+	@$(SILENT) || printf "$(MSG_GENERATING) $@" | $(AWK_CMD)
+	$(eval CMD=$(QMK_BIN) generate-leader-sequences-h --quiet --output $(INTERMEDIATE_OUTPUT)/src/leader_sequences.h $(KEYMAP_JSON))
+	@$(BUILD_CMD)
+
+generated-files: $(INTERMEDIATE_OUTPUT)/src/config.h $(INTERMEDIATE_OUTPUT)/src/keymap.c $(INTERMEDIATE_OUTPUT)/src/keymap.h $(INTERMEDIATE_OUTPUT)/src/leader_sequences.h
 
 endif
 
@@ -510,6 +525,16 @@ define post_rules_mk_community_module_includer
 endef
 $(foreach module,$(COMMUNITY_MODULE_PATHS),$(eval $(call post_rules_mk_community_module_includer,$(module))))
 
+# Swap the keyboard's platform for the host simulator
+ifeq ($(strip $(SIM_BUILD)), yes)
+    include $(BUILDDEFS_PATH)/build_sim.mk
+endif
+
+# Swap the main loop for one counting cycles
+ifeq ($(strip $(CYCLES_BUILD)), yes)
+    include $(BUILDDEFS_PATH)/build_cycles.mk
+endif
+
 ifneq ("$(wildcard $(KEYMAP_PATH)/config.h)","")
     CONFIG_H += $(KEYMAP_PATH)/config.h
 endif
@@ -599,6 +624,14 @@ check-size: build
 check-md5: build
 objs-size: build
 
+sim: elf
+	$(SILENT) || printf "Copying $(TARGET) to qmk_firmware folder" | $(AWK_CMD)
+	$(COPY) $(BUILD_DIR)/$(TARGET).elf $(TARGET) && $(PRINT_OK)
+
+cycles: elf
+	$(SILENT) || printf "Copying $(TARGET).elf to qmk_firmware folder" | $(AWK_CMD)
+	$(COPY) $(BUILD_DIR)/$(TARGET).elf $(TARGET).elf && $(PRINT_OK)
+
 ifneq ($(strip $(TOP_SYMBOLS)),)
 ifeq ($(strip $(TOP_SYMBOLS)),yes)
 NUM_TOP_SYMBOLS := 10
@@ -0,0 +1,21 @@
+# Builds a keymap against the test platform, as an executable replaying matrix
+# traces on the host. See docs/unit_testing.md.
+
+PLATFORM_KEY := test
+BOOTLOADER_TYPE := none
+PROTOCOL := sim
+
+# Storage and the matrix are provided by the test platform and the simulator
+EEPROM_DRIVER := vendor
+CUSTOM_MATRIX := lite
+SRC := $(filter-out matrix.c %/matrix.c,$(SRC))
+
+# Features that drive hardware, or need a host protocol, can't be simulated
+SIM_UNSUPPORTED_FEATURES := \
+	AUDIO BACKLIGHT BLUETOOTH DIP_SWITCH ENCODER HAPTIC HD44780 JOYSTICK LCD \
+	LCD_BACKLIGHT LED_MATRIX MIDI OLED POINTING_DEVICE PS2 PS2_MOUSE \
+	QUANTUM_PAINTER RAW RGBLIGHT RGB_MATRIX SLEEP_LED ST7565 STENO USBPD VIA \
+	VIRTSER WATCHDOG XT
+
+$(foreach AFEATURE,$(SIM_UNSUPPORTED_FEATURES),$(eval $(AFEATURE)_ENABLE := no))
+SPLIT_KEYBOARD := no
@@ -43,6 +43,13 @@ ifneq ($(USE_CCACHE),no)
     CC_PREFIX ?= ccache
 endif
 
+# Share identical objects between targets built in the same tree, see util/objcache.py
+USE_OBJCACHE ?= no
+ifneq ($(USE_OBJCACHE),no)
+    CC_PREFIX ?= $(TOP_DIR)/util/objcache.py
+    export QMK_OBJCACHE_DIR ?= $(abspath $(BUILD_DIR)/objcache)
+endif
+
 #---------------- Debug Options ----------------
 
 DEBUG_ENABLE ?= no
@@ -3,6 +3,7 @@ BUILD_OPTION_NAMES = \
   MOUSEKEY_ENABLE \
   EXTRAKEY_ENABLE \
   CONSOLE_ENABLE \
+  DEFERRED_PRINT_ENABLE \
   COMMAND_ENABLE \
   NKRO_ENABLE \
   CUSTOM_MATRIX \
@@ -10,7 +11,8 @@ BUILD_OPTION_NAMES = \
   SPLIT_KEYBOARD \
   DYNAMIC_KEYMAP_ENABLE \
   USB_HID_ENABLE \
-  VIA_ENABLE
+  VIA_ENABLE \
+  VIA_BULK_ENABLE
 
 HARDWARE_OPTION_NAMES = \
   SLEEP_LED_ENABLE \
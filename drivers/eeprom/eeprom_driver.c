@@ -83,3 +83,21 @@ void eeprom_driver_format(bool erase) {
     (void)erase; /* The default implementation assumes that the eeprom must be erased in order to be usable. */
     eeprom_driver_erase();
 }
+
+void eeprom_driver_task(void) __attribute__((weak));
+void eeprom_driver_task(void) {
+    /* The default implementation has no deferred work to perform. */
+}
+
+void eeprom_driver_flush(void) __attribute__((weak));
+void eeprom_driver_flush(void) {
+    /* The default implementation writes synchronously, so nothing is ever pending. */
+}
+
+void eeprom_driver_transaction_begin(void) __attribute__((weak));
+void eeprom_driver_transaction_begin(void) {
+    /* The default implementation writes through immediately, so there is nothing to stage. */
+}
+
+void eeprom_driver_transaction_commit(void) __attribute__((weak));
+void eeprom_driver_transaction_commit(void) {}
@@ -22,3 +22,7 @@
 void eeprom_driver_init(void);
 void eeprom_driver_format(bool erase);
 void eeprom_driver_erase(void);
+void eeprom_driver_task(void);
+void eeprom_driver_flush(void);
+void eeprom_driver_transaction_begin(void);
+void eeprom_driver_transaction_commit(void);
@@ -0,0 +1,173 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdint.h>
+#include <string.h>
+
+#include "eeprom.h"
+#include "eeprom_driver.h"
+#include "eeprom_external.h"
+#if defined(EEPROM_I2C)
+#    include "eeprom_i2c.h"
+#elif defined(EEPROM_SPI)
+#    include "eeprom_spi.h"
+#endif
+
+#if EXTERNAL_EEPROM_WRITE_QUEUE_PAGES > 0
+
+typedef struct {
+    uintptr_t base;       // page-aligned address of the cached page
+    uint16_t  dirty_from; // first modified byte within the page
+    uint16_t  dirty_to;   // one past the last modified byte within the page
+    uint8_t   data[EXTERNAL_EEPROM_PAGE_SIZE];
+} eeprom_queued_page_t;
+
+// FIFO of pages awaiting write-back, oldest entry at queue_head
+static eeprom_queued_page_t write_queue[EXTERNAL_EEPROM_WRITE_QUEUE_PAGES];
+static uint8_t              queue_head  = 0;
+static uint8_t              queue_count = 0;
+
+// Write-back is held off while a transaction is open, so that related writes coalesce into the same pages
+static uint8_t transaction_depth = 0;
+
+static inline eeprom_queued_page_t *queue_entry(uint8_t index) {
+    return &write_queue[(queue_head + index) % EXTERNAL_EEPROM_WRITE_QUEUE_PAGES];
+}
+
+static eeprom_queued_page_t *queue_find(uintptr_t base) {
+    for (uint8_t i = 0; i < queue_count; ++i) {
+        eeprom_queued_page_t *page = queue_entry(i);
+        if (page->base == base) {
+            return page;
+        }
+    }
+    return NULL;
+}
+
+static void queue_write_oldest(void) {
+    eeprom_queued_page_t *page = queue_entry(0);
+    while (eeprom_external_is_busy()) {
+    }
+    eeprom_external_write_page(page->base + page->dirty_from, &page->data[page->dirty_from], page->dirty_to - page->dirty_from);
+    queue_head = (queue_head + 1) % EXTERNAL_EEPROM_WRITE_QUEUE_PAGES;
+    --queue_count;
+}
+
+static void queue_push(uintptr_t addr, const uint8_t *buf, size_t len) {
+    uintptr_t base   = addr - (addr % EXTERNAL_EEPROM_PAGE_SIZE);
+    uint16_t  offset = addr - base;
+
+    eeprom_queued_page_t *page = queue_find(base);
+    if (page == NULL) {
+        if (queue_count == EXTERNAL_EEPROM_WRITE_QUEUE_PAGES) {
+            queue_write_oldest();
+        }
+        page             = queue_entry(queue_count++);
+        page->base       = base;
+        page->dirty_from = EXTERNAL_EEPROM_PAGE_SIZE;
+        page->dirty_to   = 0;
+        eeprom_external_read(base, page->data, EXTERNAL_EEPROM_PAGE_SIZE);
+    }
+
+    for (uint16_t i = 0; i < len; ++i) {
+        if (page->data[offset + i] != buf[i]) {
+            page->data[offset + i] = buf[i];
+            if (offset + i < page->dirty_from) page->dirty_from = offset + i;
+            if (offset + i >= page->dirty_to) page->dirty_to = offset + i + 1;
+        }
+    }
+
+    // Nothing changed on a freshly-cached page, so there's nothing to write back -- it's always the newest entry
+    if (page->dirty_from >= page->dirty_to) {
+        --queue_count;
+    }
+}
+
+static void queue_overlay(uintptr_t addr, uint8_t *buf, size_t len) {
+    for (uint8_t i = 0; i < queue_count; ++i) {
+        eeprom_queued_page_t *page = queue_entry(i);
+        if (page->base + EXTERNAL_EEPROM_PAGE_SIZE <= addr || page->base >= addr + len) {
+            continue;
+        }
+        uintptr_t from = page->base > addr ? page->base : addr;
+        uintptr_t to   = page->base + EXTERNAL_EEPROM_PAGE_SIZE < addr + len ? page->base + EXTERNAL_EEPROM_PAGE_SIZE : addr + len;
+        memcpy(&buf[from - addr], &page->data[from - page->base], to - from);
+    }
+}
+
+void eeprom_driver_task(void) {
+    if (transaction_depth == 0 && queue_count > 0 && !eeprom_external_is_busy()) {
+        queue_write_oldest();
+    }
+}
+
+void eeprom_driver_flush(void) {
+    while (queue_count > 0) {
+        queue_write_oldest();
+    }
+}
+
+void eeprom_driver_transaction_begin(void) {
+    ++transaction_depth;
+}
+
+void eeprom_driver_transaction_commit(void) {
+    if (transaction_depth > 0) {
+        --transaction_depth;
+    }
+}
+
+#endif // EXTERNAL_EEPROM_WRITE_QUEUE_PAGES > 0
+
+#if defined(EXTERNAL_EEPROM_COMPARE_BEFORE_WRITE) && EXTERNAL_EEPROM_WRITE_QUEUE_PAGES == 0
+static void compare_and_write_page(uintptr_t addr, const uint8_t *buf, size_t len) {
+    uint8_t current[EXTERNAL_EEPROM_PAGE_SIZE];
+    eeprom_external_read(addr, current, len);
+
+    // A page write costs one write cycle regardless of length, so only the outermost changed bytes matter
+    size_t from = 0;
+    size_t to   = len;
+    while (from < to && current[from] == buf[from]) {
+        ++from;
+    }
+    while (to > from && current[to - 1] == buf[to - 1]) {
+        --to;
+    }
+
+    if (from < to) {
+        eeprom_external_write_page(addr + from, &buf[from], to - from);
+    }
+}
+#endif
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    eeprom_external_read((uintptr_t)addr, (uint8_t *)buf, len);
+#if EXTERNAL_EEPROM_WRITE_QUEUE_PAGES > 0
+    queue_overlay((uintptr_t)addr, (uint8_t *)buf, len);
+#endif
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *read_buf    = (const uint8_t *)buf;
+    uintptr_t      target_addr = (uintptr_t)addr;
+
+    while (len > 0) {
+        uintptr_t page_offset  = target_addr % EXTERNAL_EEPROM_PAGE_SIZE;
+        size_t    write_length = EXTERNAL_EEPROM_PAGE_SIZE - page_offset;
+        if (write_length > len) {
+            write_length = len;
+        }
+
+#if EXTERNAL_EEPROM_WRITE_QUEUE_PAGES > 0
+        queue_push(target_addr, read_buf, write_length);
+#elif defined(EXTERNAL_EEPROM_COMPARE_BEFORE_WRITE)
+        compare_and_write_page(target_addr, read_buf, write_length);
+#else
+        eeprom_external_write_page(target_addr, read_buf, write_length);
+#endif
+
+        read_buf += write_length;
+        target_addr += write_length;
+        len -= write_length;
+    }
+}
@@ -0,0 +1,40 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+    Common block read/write handling for external (I2C/SPI) EEPROMs.
+
+    The bus-specific drivers only need to provide raw reads, single-page
+    writes and a busy check -- page splitting, compare-before-write and the
+    asynchronous write queue are shared between them.
+*/
+
+/*
+    Read back the current contents of each page before writing, and only write
+    the span of bytes which actually changed. Pages with no changes are skipped
+    entirely, avoiding the write cycle time.
+*/
+// #define EXTERNAL_EEPROM_COMPARE_BEFORE_WRITE
+
+/*
+    The number of pages which may be held in RAM pending write-back to the
+    EEPROM. When non-zero, writes are staged in RAM and drained one page at a
+    time from eeprom_driver_task(), so the write cycle time no longer blocks
+    the main loop. Pending data is always visible to subsequent reads. Each
+    queued page uses EXTERNAL_EEPROM_PAGE_SIZE bytes of RAM, and implies
+    compare-before-write.
+*/
+#ifndef EXTERNAL_EEPROM_WRITE_QUEUE_PAGES
+#    define EXTERNAL_EEPROM_WRITE_QUEUE_PAGES 0
+#endif
+
+/* Implemented by the bus-specific driver. */
+bool eeprom_external_is_busy(void);
+void eeprom_external_read(uintptr_t addr, uint8_t *buf, size_t len);
+void eeprom_external_write_page(uintptr_t addr, const uint8_t *buf, size_t len);
@@ -23,7 +23,9 @@
 /*
     Note that the implementations of eeprom_XXXX_YYYY on AVR are normally
     provided by avr-libc. The same functions are reimplemented below and are
-    rerouted to the external i2c equivalent.
+    rerouted to the external i2c equivalent -- block reads and writes are
+    handled by eeprom_external.c, which calls into the page-level functions
+    below.
 
     Seemingly, as this is compiled from within QMK, the object file generated
     during the build overrides the avr-libc implementation during the linking
@@ -34,18 +36,24 @@
 */
 
 #include "wait.h"
+#include "timer.h"
 #include "i2c_master.h"
 #include "eeprom.h"
 #include "eeprom_driver.h"
+#include "eeprom_external.h"
 #include "eeprom_i2c.h"
 
 // #define DEBUG_EEPROM_OUTPUT
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-#    include "timer.h"
 #    include "debug.h"
 #endif // DEBUG_EEPROM_OUTPUT
 
+#if EXTERNAL_EEPROM_WRITE_TIME > 0
+static uint32_t write_cycle_start   = 0;
+static bool     write_cycle_pending = false;
+#endif
+
 static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     uintptr_t p = (uintptr_t)addr;
     for (int i = 0; i < EXTERNAL_EEPROM_ADDRESS_SIZE; ++i) {
@@ -86,59 +94,71 @@ void eeprom_driver_erase(void) {
 #endif
 }
 
-void eeprom_read_block(void *buf, const void *addr, size_t len) {
+bool eeprom_external_is_busy(void) {
+#if EXTERNAL_EEPROM_WRITE_TIME > 0
+    /* The EEPROM will not respond until its internal write cycle has completed */
+    if (write_cycle_pending) {
+        write_cycle_pending = timer_elapsed32(write_cycle_start) <= EXTERNAL_EEPROM_WRITE_TIME;
+    }
+    return write_cycle_pending;
+#else
+    return false;
+#endif
+}
+
+static void eeprom_i2c_wait_while_busy(void) {
+    while (eeprom_external_is_busy()) {
+        wait_ms(1);
+    }
+}
+
+void eeprom_external_read(uintptr_t addr, uint8_t *buf, size_t len) {
     uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
-    fill_target_address(complete_packet, addr);
+    fill_target_address(complete_packet, (const void *)addr);
 
-    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
-    i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), buf, len, 100);
+    eeprom_i2c_wait_while_busy();
+    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS(addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
+    i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS(addr), buf, len, 100);
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
     dprintf("[EEPROM R] 0x%04X: ", ((int)addr));
     for (size_t i = 0; i < len; ++i) {
-        dprintf(" %02X", (int)(((uint8_t *)buf)[i]));
+        dprintf(" %02X", (int)(buf[i]));
     }
     dprintf("\n");
 #endif // DEBUG_EEPROM_OUTPUT
 }
 
-void eeprom_write_block(const void *buf, void *addr, size_t len) {
-    uint8_t   complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
-    uint8_t * read_buf    = (uint8_t *)buf;
-    uintptr_t target_addr = (uintptr_t)addr;
+void eeprom_external_write_page(uintptr_t addr, const uint8_t *buf, size_t len) {
+    uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
+
+    fill_target_address(complete_packet, (const void *)addr);
+    for (uint8_t i = 0; i < len; i++) {
+        complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + i] = buf[i];
+    }
+
+#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
+    dprintf("[EEPROM W] 0x%04X: ", ((int)addr));
+    for (uint8_t i = 0; i < len; i++) {
+        dprintf(" %02X", (int)(buf[i]));
+    }
+    dprintf("\n");
+#endif // DEBUG_EEPROM_OUTPUT
+
+    eeprom_i2c_wait_while_busy();
 
 #if defined(EXTERNAL_EEPROM_WP_PIN)
     gpio_set_pin_output(EXTERNAL_EEPROM_WP_PIN);
     gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 0);
 #endif
 
-    while (len > 0) {
-        uintptr_t page_offset  = target_addr % EXTERNAL_EEPROM_PAGE_SIZE;
-        int       write_length = EXTERNAL_EEPROM_PAGE_SIZE - page_offset;
-        if (write_length > len) {
-            write_length = len;
-        }
-
-        fill_target_address(complete_packet, (const void *)target_addr);
-        for (uint8_t i = 0; i < write_length; i++) {
-            complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + i] = read_buf[i];
-        }
+    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS(addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + len, 100);
 
-#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-        dprintf("[EEPROM W] 0x%04X: ", ((int)target_addr));
-        for (uint8_t i = 0; i < write_length; i++) {
-            dprintf(" %02X", (int)(read_buf[i]));
-        }
-        dprintf("\n");
-#endif // DEBUG_EEPROM_OUTPUT
-
-        i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + write_length, 100);
-        wait_ms(EXTERNAL_EEPROM_WRITE_TIME);
-
-        read_buf += write_length;
-        target_addr += write_length;
-        len -= write_length;
-    }
+#if EXTERNAL_EEPROM_WRITE_TIME > 0
+    /* Rather than blocking here for the write cycle, defer the wait until the EEPROM is next accessed */
+    write_cycle_start   = timer_read32();
+    write_cycle_pending = true;
+#endif
 
 #if defined(EXTERNAL_EEPROM_WP_PIN)
     /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
@@ -27,3 +27,11 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
     wear_leveling_write((uint32_t)addr, buf, len);
 }
+
+void eeprom_driver_transaction_begin(void) {
+    wear_leveling_transaction_begin();
+}
+
+void eeprom_driver_transaction_commit(void) {
+    wear_leveling_transaction_commit();
+}
@@ -10,10 +10,19 @@
 #include "keycodes.h"
 #include "wait.h"
 
+#include "atomic_util.h"
+
 #ifdef SPLIT_KEYBOARD
 #    include "split_util.h"
 #endif
 
+#ifdef ENCODER_QUADRATURE_INTERRUPTS
+#    ifndef PROTOCOL_CHIBIOS
+#        error ENCODER_QUADRATURE_INTERRUPTS is only supported on ChibiOS.
+#    endif
+#    include <hal.h>
+#endif
+
 // for memcpy
 #include <string.h>
 
@@ -73,6 +82,8 @@ static int8_t encoder_LUT[] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1,
 
 static uint8_t encoder_state[NUM_ENCODERS]  = {0};
 static int8_t  encoder_pulses[NUM_ENCODERS] = {0};
+// Detents decoded but not yet queued, positive for counter-clockwise. Written from interrupts when pins are read there.
+static volatile int16_t encoder_detents[NUM_ENCODERS] = {0};
 
 // encoder counts
 static uint8_t thisCount;
@@ -86,9 +97,35 @@ static uint8_t thatCount;
 __attribute__((weak)) void encoder_quadrature_post_init_kb(void) {
     extern void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t pin_b_state);
     // Unused normally, but can be used for things like setting up pin-change interrupts in keyboard code.
-    // During the interrupt, read the pins then call `encoder_handle_read()` with the pin states and it'll queue up an encoder event if needed.
+    // During the interrupt, read the pins then call `encoder_quadrature_handle_read()` with the pin states and it'll count up any detents.
+    // They are queued as encoder events by the next `encoder_driver_task()`.
+}
+
+#ifdef ENCODER_QUADRATURE_INTERRUPTS
+#    ifndef ENCODER_DEFAULT_PIN_API_IMPL
+#        error ENCODER_QUADRATURE_INTERRUPTS requires ENCODER_A_PINS and ENCODER_B_PINS.
+#    endif
+
+void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t pin_b_state);
+
+static void encoder_quadrature_pin_callback(void *arg) {
+    uint8_t index = (uint8_t)(uintptr_t)arg;
+    chSysLockFromISR();
+    encoder_quadrature_handle_read(index, encoder_quadrature_read_pin(index, false), encoder_quadrature_read_pin(index, true));
+    chSysUnlockFromISR();
 }
 
+static void encoder_quadrature_enable_interrupts(void) {
+    for (uint8_t i = 0; i < thisCount; i++) {
+        // Both pins of an encoder trigger the same decode, and every edge is a quadrature transition
+        palEnableLineEvent(encoders_pad_a[i], PAL_EVENT_MODE_BOTH_EDGES);
+        palSetLineCallback(encoders_pad_a[i], encoder_quadrature_pin_callback, (void *)(uintptr_t)i);
+        palEnableLineEvent(encoders_pad_b[i], PAL_EVENT_MODE_BOTH_EDGES);
+        palSetLineCallback(encoders_pad_b[i], encoder_quadrature_pin_callback, (void *)(uintptr_t)i);
+    }
+}
+#endif // ENCODER_QUADRATURE_INTERRUPTS
+
 void encoder_quadrature_post_init(void) {
 #ifdef ENCODER_DEFAULT_PIN_API_IMPL
     for (uint8_t i = 0; i < thisCount; i++) {
@@ -102,6 +139,9 @@ void encoder_quadrature_post_init(void) {
 #else
     memset(encoder_state, 0, sizeof(encoder_state));
 #endif
+#ifdef ENCODER_QUADRATURE_INTERRUPTS
+    encoder_quadrature_enable_interrupts();
+#endif
 
     encoder_quadrature_post_init_kb();
 }
@@ -123,6 +163,7 @@ void encoder_driver_init(void) {
     // here, but it's the simplest solution.
     memset(encoder_state, 0, sizeof(encoder_state));
     memset(encoder_pulses, 0, sizeof(encoder_pulses));
+    memset((void *)encoder_detents, 0, sizeof(encoder_detents));
     const pin_t encoders_pad_a_left[] = ENCODER_A_PINS;
     const pin_t encoders_pad_b_left[] = ENCODER_B_PINS;
     for (uint8_t i = 0; i < thisCount; i++) {
@@ -180,7 +221,7 @@ static void encoder_handle_state_change(uint8_t index, uint8_t state) {
     if (encoder_pulses[i] >= resolution) {
 #endif
 
-            encoder_queue_event(index, ENCODER_COUNTER_CLOCKWISE);
+            encoder_detents[i]++;
         }
 
 #ifdef ENCODER_DEFAULT_POS
@@ -188,7 +229,7 @@ static void encoder_handle_state_change(uint8_t index, uint8_t state) {
 #else
     if (encoder_pulses[i] <= -resolution) { // direction is arbitrary here, but this clockwise
 #endif
-            encoder_queue_event(index, ENCODER_CLOCKWISE);
+            encoder_detents[i]--;
         }
         encoder_pulses[i] %= resolution;
 #ifdef ENCODER_DEFAULT_POS
@@ -206,8 +247,41 @@ void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t
     }
 }
 
+void encoder_quadrature_queue_detents(void) {
+    for (uint8_t i = 0; i < thisCount; i++) {
+        int16_t detents;
+        ATOMIC_BLOCK_FORCEON {
+            detents = encoder_detents[i];
+        }
+        if (detents == 0) {
+            continue;
+        }
+
+#ifdef SPLIT_KEYBOARD
+        uint8_t index = i + thisHand;
+#else
+        uint8_t index = i;
+#endif
+        // Whatever doesn't fit in the queue is kept for the next task, rather than dropped
+        int16_t queued = 0;
+        while (queued < detents && encoder_queue_event(index, ENCODER_COUNTER_CLOCKWISE)) {
+            queued++;
+        }
+        while (queued > detents && encoder_queue_event(index, ENCODER_CLOCKWISE)) {
+            queued--;
+        }
+
+        ATOMIC_BLOCK_FORCEON {
+            encoder_detents[i] -= queued;
+        }
+    }
+}
+
 __attribute__((weak)) void encoder_driver_task(void) {
+#ifndef ENCODER_QUADRATURE_INTERRUPTS
     for (uint8_t i = 0; i < thisCount; i++) {
         encoder_quadrature_handle_read(i, encoder_quadrature_read_pin(i, false), encoder_quadrature_read_pin(i, true));
     }
+#endif
+    encoder_quadrature_queue_detents();
 }
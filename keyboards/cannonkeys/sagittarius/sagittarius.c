@@ -35,6 +35,10 @@ void encoder_driver_task(void) {
     for (uint8_t i = 0; i < 4; i++) {
         gpio_set_pin_input_high(matrix_row_pins[i]);
     }
+
+    // Queue up any detents decoded above
+    extern void encoder_quadrature_queue_detents(void);
+    encoder_quadrature_queue_detents();
 }
 
 #endif // defined(ENCODER_ENABLE) || defined(ENCODER_MAP_ENABLE)
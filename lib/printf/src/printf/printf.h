@@ -0,0 +1,3 @@
+#pragma once
+#include <stdio.h>
+void putchar_(char c);
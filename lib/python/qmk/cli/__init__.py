@@ -38,6 +38,7 @@ subcommands = [
     'qmk.cli.chibios.confmigrate',
     'qmk.cli.clean',
     'qmk.cli.compile',
+    'qmk.cli.console_decode',
     'qmk.cli.docs',
     'qmk.cli.doctor',
     'qmk.cli.find',
@@ -60,6 +61,7 @@ subcommands = [
     'qmk.cli.generate.keycodes',
     'qmk.cli.generate.keycodes_tests',
     'qmk.cli.generate.keymap_h',
+    'qmk.cli.generate.leader_sequences',
     'qmk.cli.generate.make_dependencies',
     'qmk.cli.generate.rgb_breathe_table',
     'qmk.cli.generate.rules_mk',
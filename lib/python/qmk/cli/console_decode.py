@@ -0,0 +1,39 @@
+"""Decode deferred print records in console output.
+"""
+import sys
+
+from argcomplete.completers import FilesCompleter
+from milc import cli
+
+import qmk.path
+from qmk.deferred_print import DeferredPrintDecoder, DeferredPrintError
+
+
+@cli.argument('-e', '--elf', arg_only=True, required=True, type=qmk.path.normpath, completer=FilesCompleter('.elf'), help='The .elf file of the firmware the keyboard runs.')
+@cli.argument('filename', nargs='?', arg_only=True, type=qmk.path.FileType('r'), completer=FilesCompleter('.txt'), help='Console output to decode, or - for stdin (default).')
+@cli.subcommand('Decodes the records of keyboards built with DEFERRED_PRINT_ENABLE in console output.')
+def console_decode(cli):
+    """Decodes the records of keyboards built with DEFERRED_PRINT_ENABLE.
+
+    Lines of console output, for example from `qmk console`, are read from a file or stdin. Deferred print records are formatted using the format strings in the firmware's .elf file, and all other lines are passed through as they are.
+    """
+    if not cli.args.elf.exists():
+        cli.log.error('No such file: %s', cli.args.elf)
+        return False
+
+    try:
+        decoder = DeferredPrintDecoder.from_elf(cli.args.elf)
+    except DeferredPrintError as e:
+        cli.log.error('Could not read %s: %s', cli.args.elf, e)
+        return False
+
+    source = cli.args.filename or sys.stdin
+    if not hasattr(source, 'readline'):
+        source = source.open(encoding='utf-8', errors='replace')
+
+    try:
+        for line in source:
+            sys.stdout.write(decoder.decode_line(line))
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
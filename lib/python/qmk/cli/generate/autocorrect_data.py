@@ -28,7 +28,7 @@ For full documentation, see QMK Docs
 """
 
 import textwrap
-from typing import Any, Dict, Iterator, List, Tuple
+from typing import Any, Dict, Iterator, List, Optional, Tuple
 
 from milc import cli
 
@@ -43,6 +43,9 @@ KC_A = 4
 KC_SPC = 0x2c
 KC_QUOT = 0x34
 
+# Largest byte offset a node link of the given size can encode
+LINK_LIMITS = {2: 0xffff, 3: 0xffffff}
+
 TYPO_CHARS = dict([
     ("'", KC_QUOT),
     (':', KC_SPC),  # "Word break" character.
@@ -165,54 +168,83 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
-def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
+def make_leaf_data(typo: str, correction: str) -> List[int]:
+    """Makes the serialized data of a leaf, the number of backspaces followed by the correction string."""
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0  # Make the autocorrection data for this entry and serialize it.
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    correction = correction[i:]
+    bs_count = [backspaces + 128]
+    return bs_count + list(bytes(correction, 'ascii')) + [0]
+
+
+def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any], link_bytes: Optional[int] = None) -> Tuple[List[int], int]:
     """Serializes trie and correction data in a form readable by the C code.
+  Identical subtrees are only serialized once, turning the trie into a DAWG.
   Args:
     autocorrections: List of (typo, correction) tuples.
     trie: Dict of dicts.
+    link_bytes: Size of node links, 2 or 3 bytes. Picks the smallest that fits if None.
   Returns:
-    List of ints in the range 0-255.
+    List of ints in the range 0-255, and the size of the node links.
   """
     table = []
 
+    # Give every distinct subtree a unique id, so that identical subtrees can be found in constant time.
+    subtree_ids = {}
+    interned = {}
+
+    def identify(trie_node):
+        if 'LEAF' in trie_node:
+            key = ('LEAF', tuple(make_leaf_data(*trie_node['LEAF'])))
+        else:
+            key = tuple((c, identify(trie_node[c])) for c in sorted(trie_node.keys()))
+        subtree_ids[id(trie_node)] = interned.setdefault(key, len(interned))
+        return subtree_ids[id(trie_node)]
+
+    identify(trie)
+
+    # Where each distinct subtree has been serialized, as (table entry, byte offset within the entry).
+    serialized = {}
+
+    def link_to(trie_node):
+        """Links to an existing serialization of the subtree, or serializes it if there is none yet."""
+        return serialized.get(subtree_ids[id(trie_node)]) or traverse(trie_node)
+
     # Traverse trie in depth first order.
     def traverse(trie_node):
+        entry = {'links': [], 'byte_offset': 0}
+        serialized[subtree_ids[id(trie_node)]] = (entry, 0)
+        table.append(entry)
+
         if 'LEAF' in trie_node:  # Handle a leaf trie node.
-            typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
-            entry = {'data': data, 'links': [], 'byte_offset': 0}
-            table.append(entry)
+            entry['data'] = make_leaf_data(*trie_node['LEAF'])
         elif len(trie_node) == 1:  # Handle trie node with a single child.
             c, trie_node = next(iter(trie_node.items()))
-            entry = {'chars': c, 'byte_offset': 0}
+            entry['chars'] = c
 
             # It's common for a trie to have long chains of single-child nodes. We
             # find the whole chain so that we can serialize it more efficiently.
             while len(trie_node) == 1 and 'LEAF' not in trie_node:
+                # Links may point into the middle of a chain, so its tails can be shared too
+                serialized.setdefault(subtree_ids[id(trie_node)], (entry, len(entry['chars'])))
                 c, trie_node = next(iter(trie_node.items()))
                 entry['chars'] += c
 
-            table.append(entry)
+            # The child of a chain always immediately follows it, so it can't be shared
             entry['links'] = [traverse(trie_node)]
         else:  # Handle trie node with multiple children.
-            entry = {'chars': ''.join(sorted(trie_node.keys())), 'byte_offset': 0}
-            table.append(entry)
-            entry['links'] = [traverse(trie_node[c]) for c in entry['chars']]
-        return entry
+            entry['chars'] = ''.join(sorted(trie_node.keys()))
+            entry['links'] = [link_to(trie_node[c]) for c in entry['chars']]
+        return (entry, 0)
 
     traverse(trie)
 
-    def serialize(e: Dict[str, Any]) -> List[int]:
+    def serialize(e: Dict[str, Any], link_bytes: int) -> List[int]:
         if not e['links']:  # Handle a leaf table entry.
             return e['data']
         elif len(e['links']) == 1:  # Handle a chain table entry.
@@ -220,25 +252,38 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
         else:  # Handle a branch table entry.
             data = []
             for c, link in zip(e['chars'], e['links']):
-                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link)
+                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link, link_bytes)
             return data + [0]
 
-    byte_offset = 0
-    for e in table:  # To encode links, first compute byte offset of each entry.
-        e['byte_offset'] = byte_offset
-        byte_offset += len(serialize(e))
-        assert 0 <= byte_offset <= 0xffff
+    def entry_size(e: Dict[str, Any], link_bytes: int) -> int:
+        if len(e['links']) > 1:  # A keycode and link per branch, plus the terminator.
+            return len(e['chars']) * (1 + link_bytes) + 1
+        return len(serialize(e, link_bytes))
+
+    def layout(link_bytes: int) -> int:
+        byte_offset = 0
+        for e in table:  # To encode links, first compute byte offset of each entry.
+            e['byte_offset'] = byte_offset
+            byte_offset += entry_size(e, link_bytes)
+        return byte_offset
+
+    if link_bytes is None:
+        link_bytes = 2 if layout(2) <= LINK_LIMITS[2] else 3
+    if layout(link_bytes) > LINK_LIMITS[link_bytes]:
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large for %d byte node links. Try reducing the autocorrection dict to fewer entries.', link_bytes)
+        maybe_exit(1)
 
-    return [b for e in table for b in serialize(e)]  # Serialize final table.
+    return [b for e in table for b in serialize(e, link_bytes)], link_bytes  # Serialize final table.
 
 
-def encode_link(link: Dict[str, Any]) -> List[int]:
-    """Encodes a node link as two bytes."""
-    byte_offset = link['byte_offset']
-    if not (0 <= byte_offset <= 0xffff):
-        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries.')
+def encode_link(link: Tuple[Dict[str, Any], int], link_bytes: int = 2) -> List[int]:
+    """Encodes a node link as two or three bytes."""
+    entry, offset = link
+    byte_offset = entry['byte_offset'] + offset
+    if not (0 <= byte_offset <= LINK_LIMITS[link_bytes]):
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large for %d byte node links. Try reducing the autocorrection dict to fewer entries.', link_bytes)
         maybe_exit(1)
-    return [byte_offset & 255, byte_offset >> 8]
+    return [(byte_offset >> (8 * i)) & 255 for i in range(link_bytes)]
 
 
 def typo_len(e: Tuple[str, str]) -> int:
@@ -254,11 +299,12 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('--link-bytes', arg_only=True, type=int, choices=[2, 3], help='Size of the links between trie nodes. Defaults to 2, or 3 if the dictionary is too large for 2.')
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    data, link_bytes = serialize_trie(autocorrections, trie, cli.args.link_bytes)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -282,6 +328,7 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    autocorrect_data_h_lines.append(f'#define AUTOCORRECT_DATA_LINK_BYTES {link_bytes}')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
     autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
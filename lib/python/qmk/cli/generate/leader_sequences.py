@@ -0,0 +1,117 @@
+"""Used by the make system to generate leader_sequences.h from keymap.json
+
+The leader sequences of the keymap are compiled into a trie, serialized as an
+array of 16-bit words. Each node is laid out as:
+
+    <number of children> <keycode to send, or KC_NO> [<keycode> <child node offset>]...
+
+so that the firmware can advance through it one key press at a time, and send a
+sequence's keycode as soon as no longer sequence shares its prefix.
+"""
+from argcomplete.completers import FilesCompleter
+
+from milc import cli
+
+import qmk.path
+from qmk.commands import dump_lines
+from qmk.commands import parse_configurator_json
+from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
+from qmk.util import maybe_exit
+
+# Must match the size of the leader_sequence buffer in quantum/leader.c, which
+# checks LEADER_SEQUENCES_MAX_LENGTH against it
+LEADER_SEQUENCE_MAX_LENGTH = 5
+
+# Offsets are stored in 16-bit words
+TRIE_MAX_SIZE = 0xffff
+
+
+def _build_trie(sequences):
+    """Builds a nested dict trie, where the '' key of a node holds the keycode to send.
+    """
+    trie = {}
+
+    for item in sequences:
+        sequence = item['sequence']
+        node = trie
+
+        if not sequence:
+            cli.log.error('Leader sequences must contain at least one keycode')
+            maybe_exit(1)
+        if len(sequence) > LEADER_SEQUENCE_MAX_LENGTH:
+            cli.log.error(f'Leader sequence {", ".join(sequence)} is longer than {LEADER_SEQUENCE_MAX_LENGTH} keycodes')
+            maybe_exit(1)
+
+        for keycode in sequence:
+            node = node.setdefault(keycode, {})
+
+        if '' in node:
+            cli.log.error(f'Leader sequence {", ".join(sequence)} is defined more than once')
+            maybe_exit(1)
+        node[''] = item['keycode']
+
+    return trie
+
+
+def _serialize_trie(trie):
+    """Serializes the trie breadth-first, returning a list of (comment, words) tuples, one per node.
+    """
+    nodes = []
+    queue = [(trie, [])]
+    offset = 0
+
+    # First pass assigns each node its offset
+    offsets = []
+    for node, path in queue:
+        children = [k for k in node if k != '']
+        offsets.append(offset)
+        offset += 2 + 2 * len(children)
+        for keycode in children:
+            queue.append((node[keycode], path + [keycode]))
+
+    if offset > TRIE_MAX_SIZE:
+        cli.log.error(f'Leader sequence trie is too large ({offset} words)')
+        maybe_exit(1)
+
+    # Second pass emits the nodes, whose children were queued in the same order as above
+    next_node = 1
+    for node, path in queue:
+        children = [k for k in node if k != '']
+        words = [str(len(children)), node.get('', 'KC_NO')]
+        for keycode in children:
+            words += [keycode, str(offsets[next_node])]
+            next_node += 1
+        nodes.append((', '.join(path) if path else 'root', words))
+
+    return nodes, offset
+
+
+@cli.argument('-o', '--output', arg_only=True, type=qmk.path.normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('filename', type=qmk.path.FileType('r'), arg_only=True, completer=FilesCompleter('.json'), help='Configurator JSON file')
+@cli.subcommand('Creates a leader_sequences.h from a QMK Configurator export.')
+def generate_leader_sequences_h(cli):
+    """Creates a leader_sequences.h from a QMK Configurator export
+    """
+    if cli.args.output and cli.args.output.name == '-':
+        cli.args.output = None
+
+    lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '#pragma once', '// clang-format off']
+
+    keymap_json = parse_configurator_json(cli.args.filename)
+    sequences = keymap_json.get('leader_sequences')
+
+    if sequences:
+        nodes, size = _serialize_trie(_build_trie(sequences))
+
+        lines.append('')
+        lines.append(f'#define LEADER_SEQUENCES_COUNT {len(sequences)}')
+        lines.append(f'#define LEADER_SEQUENCES_MAX_LENGTH {max(len(item["sequence"]) for item in sequences)}')
+        lines.append(f'#define LEADER_SEQUENCES_TRIE_SIZE {size}')
+        lines.append('')
+        lines.append('static const uint16_t leader_sequences_trie[LEADER_SEQUENCES_TRIE_SIZE] PROGMEM = {')
+        for comment, words in nodes:
+            lines.append(f'    {", ".join(words)}, // {comment}')
+        lines.append('};')
+
+    dump_lines(cli.args.output, lines, cli.args.quiet)
@@ -16,7 +16,18 @@ from qmk.build_targets import BuildTarget, JsonKeymapBuildTarget
 from qmk.util import maybe_exit_config
 
 
-def mass_compile_targets(targets: List[BuildTarget], clean: bool, dry_run: bool, no_temp: bool, parallel: int, **env):
+def _object_cache_stats(stats_file: Path, offset: int):
+    """Counts the cache hits and misses recorded past the given offset of the stats file.
+    """
+    if not stats_file.exists():
+        return 0, 0
+    with open(stats_file) as f:
+        f.seek(offset)
+        outcomes = [line.split(' ', 1)[0] for line in f]
+    return outcomes.count('hit'), outcomes.count('miss')
+
+
+def mass_compile_targets(targets: List[BuildTarget], clean: bool, dry_run: bool, no_temp: bool, parallel: int, object_cache: bool = False, **env):
     if len(targets) == 0:
         return
 
@@ -25,6 +36,10 @@ def mass_compile_targets(targets: List[BuildTarget], clean: bool, dry_run: bool,
     make_cmd = find_make()
     builddir = Path(QMK_FIRMWARE) / '.build'
     makefile = builddir / 'parallel_kb_builds.mk'
+    stats_file = builddir / 'objcache' / 'stats'
+
+    if object_cache:
+        env['USE_OBJCACHE'] = 'yes'
 
     if dry_run:
         cli.log.info('Compilation targets:')
@@ -85,8 +100,13 @@ all: {target_filename}{target_suffix}_binary
                     # yapf: enable
                 f.write('\n')
 
+        stats_offset = stats_file.stat().st_size if stats_file.exists() else 0
         cli.run([find_make(), *get_make_parallel_args(parallel), '-f', makefile.as_posix(), 'all'], capture_output=False, stdin=DEVNULL)
 
+        if object_cache:
+            hits, misses = _object_cache_stats(stats_file, stats_offset)
+            cli.log.info(f'Object cache: {hits} hits, {misses} misses')
+
         # Check for failures
         failures = [f for f in builddir.glob(f'failed.log.{os.getpid()}.*')]
         if len(failures) > 0:
@@ -97,6 +117,7 @@ all: {target_filename}{target_suffix}_binary
 @cli.argument('-t', '--no-temp', arg_only=True, action='store_true', help="Remove temporary files during build.")
 @cli.argument('-j', '--parallel', type=int, default=1, help="Set the number of parallel make jobs; 0 means unlimited.")
 @cli.argument('-c', '--clean', arg_only=True, action='store_true', help="Remove object files before compiling.")
+@cli.argument('--object-cache', arg_only=True, action='store_true', help="Compile identical objects only once across all targets, caching them in .build/objcache.")
 @cli.argument('-n', '--dry-run', arg_only=True, action='store_true', help="Don't actually build, just show the commands to be run.")
 @cli.argument(
     '-f',
@@ -123,4 +144,4 @@ def mass_compile(cli):
     else:
         targets = search_keymap_targets([('all', cli.config.mass_compile.keymap)], cli.args.filter)
 
-    return mass_compile_targets(targets, cli.args.clean, cli.args.dry_run, cli.args.no_temp, cli.config.mass_compile.parallel, **build_environment(cli.args.env))
+    return mass_compile_targets(targets, cli.args.clean, cli.args.dry_run, cli.args.no_temp, cli.config.mass_compile.parallel, cli.args.object_cache, **build_environment(cli.args.env))
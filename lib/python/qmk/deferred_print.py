@@ -0,0 +1,158 @@
+"""Decoding of deferred print records.
+
+Keyboards built with `DEFERRED_PRINT_ENABLE = yes` send their prints as lines of `~L` followed by a hex record: the address of the format string, then the arguments with C's default argument promotions applied. The format strings are read back from the firmware's .elf file.
+"""
+import re
+import struct
+
+RECORD_RE = re.compile(r'~L([0-9A-F]+)')
+CONVERSION_RE = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|z|j|t)?([diuxXobcsSp%])')
+
+ELF_MAGIC = b'\x7fELF'
+EM_AVR = 83
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+# AVR data memory is mapped at this offset in the .elf file
+AVR_DATA_OFFSET = 0x800000
+
+
+class DeferredPrintError(Exception):
+    """Raised when a firmware file can't be used for decoding.
+    """
+
+
+class FirmwareImage:
+    """The loadable sections of a 32 bit little-endian .elf file.
+    """
+    def __init__(self, data):
+        if data[:4] != ELF_MAGIC or data[4] != 1 or data[5] != 1:
+            raise DeferredPrintError('Not a 32 bit little-endian .elf file')
+
+        self.machine = struct.unpack_from('<H', data, 18)[0]
+        self.sections = []
+
+        shoff, = struct.unpack_from('<I', data, 32)
+        shentsize, shnum = struct.unpack_from('<HH', data, 46)
+        for i in range(shnum):
+            _, sh_type, sh_flags, sh_addr, sh_offset, sh_size = struct.unpack_from('<IIIIII', data, shoff + i * shentsize)
+            if sh_flags & SHF_ALLOC and sh_type != SHT_NOBITS and sh_size > 0:
+                self.sections.append((sh_addr, data[sh_offset:sh_offset + sh_size]))
+
+    @property
+    def is_avr(self):
+        return self.machine == EM_AVR
+
+    @property
+    def int_size(self):
+        return 2 if self.is_avr else 4
+
+    @property
+    def pointer_size(self):
+        return 2 if self.is_avr else 4
+
+    def read_string(self, address):
+        """Returns the NUL terminated string at `address`, or None if it isn't part of the image.
+        """
+        for start, contents in self.sections:
+            if start <= address < start + len(contents):
+                offset = address - start
+                end = contents.find(b'\0', offset)
+                return contents[offset:end if end >= 0 else len(contents)].decode('utf-8', errors='replace')
+        return None
+
+    def read_data_string(self, address):
+        """Returns the string a pointer into RAM refers to, if it's a constant.
+        """
+        return self.read_string(address + AVR_DATA_OFFSET if self.is_avr else address)
+
+
+class DeferredPrintDecoder:
+    def __init__(self, firmware):
+        self.firmware = firmware
+
+    @classmethod
+    def from_elf(cls, path):
+        with open(path, 'rb') as f:
+            return cls(FirmwareImage(f.read()))
+
+    def decode_record(self, record):
+        """Formats a record as printf() would have on the keyboard.
+        """
+        pointer_size = self.firmware.pointer_size
+        if len(record) < pointer_size:
+            return f'<truncated deferred print record {record.hex().upper()}>\n'
+
+        address = int.from_bytes(record[:pointer_size], 'little')
+        args = record[pointer_size:]
+        if address == 0:
+            return f'<{args[0] if args else 0} deferred print records dropped>\n'
+
+        fmt = self.firmware.read_string(address)
+        if fmt is None:
+            return f'<unknown deferred print format 0x{address:X}>\n'
+
+        return self.format(fmt, args)
+
+    def format(self, fmt, args):
+        """Applies the printf() conversions of `fmt` to the raw arguments.
+        """
+        offset = 0
+
+        def take(size, signed=False):
+            nonlocal offset
+            value = int.from_bytes(args[offset:offset + size], 'little', signed=signed)
+            offset += size
+            return value
+
+        def convert(match):
+            flags, width, precision, length, conversion = match.groups()
+            if conversion == '%':
+                return '%'
+            if width == '*':
+                width = str(take(self.firmware.int_size, signed=True))
+            if precision == '*':
+                precision = str(take(self.firmware.int_size, signed=True))
+
+            if conversion in 'sSp':
+                value = take(self.firmware.pointer_size)
+            else:
+                size = 8 if length == 'll' else 4 if length in ('l', 'j') else self.firmware.pointer_size if length in ('z', 't') else self.firmware.int_size
+                value = take(size, signed=conversion in 'di')
+
+            spec = '%' + flags + (width or '') + ('.' + precision if precision is not None else '')
+            if conversion in 'diu':
+                return (spec + 'd') % value
+            if conversion in 'xXo':
+                return (spec + conversion) % value
+            if conversion == 'b':
+                return (spec + 's') % format_binary(value, flags, width)
+            if conversion == 'c':
+                return (spec + 'c') % chr(value & 0xFF)
+            if conversion == 'p':
+                return (spec + 's') % f'0x{value:0{self.firmware.pointer_size * 2}X}'
+
+            # String arguments can only be shown if they are constants in the image
+            string = self.firmware.read_string(value) if conversion == 'S' else self.firmware.read_data_string(value)
+            return (spec + 's') % (string if string is not None else f'<0x{value:X}>')
+
+        return CONVERSION_RE.sub(convert, fmt)
+
+    def decode_line(self, line):
+        """Replaces the records in a line of console output with the text they stand for.
+
+        Record lines only end where the decoded text does, anything else is passed through as it is.
+        """
+        line = line.rstrip('\r\n')
+        if not RECORD_RE.search(line):
+            return line + '\n'
+        return RECORD_RE.sub(lambda match: self.decode_record(bytes.fromhex(match.group(1))), line)
+
+
+def format_binary(value, flags, width):
+    """Formats `value` for the `%b` conversion, which Python doesn't support.
+    """
+    binary = format(value, 'b')
+    if '0' in flags and '-' not in flags and width:
+        binary = binary.zfill(int(width))
+    return binary
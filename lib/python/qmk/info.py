@@ -11,6 +11,7 @@ from milc import cli
 from qmk.constants import COL_LETTERS, ROW_LETTERS, CHIBIOS_PROCESSORS, LUFA_PROCESSORS, VUSB_PROCESSORS, JOYSTICK_AXES
 from qmk.c_parse import find_layouts, parse_config_h_file, find_led_config
 from qmk.json_schema import deep_update, json_load, validate
+from qmk.info_cache import cached_info_json
 from qmk.keyboard import config_h, rules_mk
 from qmk.commands import parse_configurator_json
 from qmk.makefile import parse_rules_mk_file
@@ -223,6 +224,12 @@ def _validate(keyboard, info_data):
 def info_json(keyboard, force_layout=None):
     """Generate the info.json data for a specific keyboard.
     """
+    return cached_info_json(_resolve_info_json, keyboard, force_layout)
+
+
+def _resolve_info_json(keyboard, force_layout=None):
+    """Merge and validate the info.json data for a specific keyboard, bypassing the cache.
+    """
     cur_dir = Path('keyboards')
     root_rules_mk = parse_rules_mk_file(cur_dir / keyboard / 'rules.mk')
 
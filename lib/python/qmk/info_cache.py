@@ -0,0 +1,173 @@
+"""On-disk cache of resolved keyboard info.json data.
+
+Resolving a keyboard's info.json means merging every info.json and keyboard.json up its directory tree, parsing its
+config.h, rules.mk and sources, and validating the result. Entries are keyed on the size and modification time of
+every file in the directories involved, the community layouts available, and the mappings, schemas and code doing the
+resolution, so that anything which could change the result invalidates them.
+"""
+import hashlib
+import json
+import logging
+import os
+from functools import lru_cache
+from pathlib import Path
+
+from milc import cli
+
+from qmk.constants import QMK_FIRMWARE
+from qmk.util import truthy
+
+CACHE_DIR = QMK_FIRMWARE / '.build' / 'info_cache'
+CACHE_VERSION = 1
+
+
+class _LogCapture(logging.Handler):
+    """Collects the messages logged while resolving a keyboard, so that they can be replayed from the cache.
+    """
+    def __init__(self):
+        super().__init__()
+        self.records = []
+
+    def emit(self, record):
+        self.records.append(record)
+
+
+def _directory_signature(directory):
+    """Lists the size and modification time of the files directly within a directory.
+    """
+    try:
+        entries = sorted(os.scandir(directory), key=lambda e: e.name)
+    except OSError:
+        return []
+
+    signature = []
+    for entry in entries:
+        if entry.is_file():
+            stat = entry.stat()
+            signature.append((entry.path, stat.st_size, stat.st_mtime_ns))
+    return signature
+
+
+def _keyboard_signature(keyboard):
+    """Covers every directory from the top of the keyboard's tree down to the keyboard itself.
+    """
+    signature = []
+    current = Path('keyboards')
+    for part in Path(keyboard).parts:
+        current = current / part
+        signature.extend(_directory_signature(current))
+    return signature
+
+
+def _community_layouts_signature():
+    """Lists the community layouts, which keyboards are checked against.
+    """
+    try:
+        return sorted(entry.name for entry in os.scandir('layouts/default') if entry.is_dir())
+    except OSError:
+        return []
+
+
+@lru_cache(maxsize=1)
+def _global_signature():
+    """Covers the data and code common to all keyboards, which doesn't change within a single invocation.
+    """
+    signature = [CACHE_VERSION]
+    for root in ('data/mappings', 'data/schemas'):
+        for directory, subdirectories, _ in os.walk(root):
+            subdirectories.sort()
+            signature.extend(_directory_signature(directory))
+    signature.extend(_directory_signature(Path(__file__).parent))
+    signature.append(_community_layouts_signature())
+    return signature
+
+
+def _cache_key(keyboard, resolved_keyboard, force_layout):
+    key = [_global_signature(), _keyboard_signature(keyboard), force_layout, truthy(os.environ.get('SKIP_SCHEMA_VALIDATION'), False)]
+    if resolved_keyboard != keyboard:
+        key.append(_keyboard_signature(resolved_keyboard))
+    return hashlib.sha256(json.dumps(key).encode()).hexdigest()
+
+
+def _cache_file(keyboard, force_layout):
+    name = f'{keyboard}@{force_layout}' if force_layout else str(keyboard)
+    return CACHE_DIR / f'{name}.json'
+
+
+def _load(keyboard, force_layout):
+    cache_file = _cache_file(keyboard, force_layout)
+    try:
+        with open(cache_file, encoding='utf-8') as f:
+            entry = json.load(f)
+    except (OSError, ValueError):
+        return None
+
+    if entry.get('key') != _cache_key(keyboard, entry.get('keyboard'), force_layout):
+        return None
+    return entry
+
+
+def _store(keyboard, force_layout, info_data, warnings):
+    entry = {
+        'key': _cache_key(keyboard, info_data['keyboard_folder'], force_layout),
+        'keyboard': info_data['keyboard_folder'],
+        'warnings': warnings,
+        'info': info_data,
+    }
+
+    # Only store what survives the round trip unchanged, such as data without tuples or non-string keys
+    try:
+        serialized = json.dumps(entry)
+    except (TypeError, ValueError) as e:
+        cli.log.debug('Not caching info.json data for %s, as it can\'t be stored as JSON: %s', keyboard, e)
+        return
+    if json.loads(serialized)['info'] != info_data:
+        cli.log.debug('Not caching info.json data for %s, as it changes when stored as JSON', keyboard)
+        return
+
+    cache_file = _cache_file(keyboard, force_layout)
+    temp_file = cache_file.with_name(f'{cache_file.name}.{os.getpid()}.tmp')
+    try:
+        cache_file.parent.mkdir(parents=True, exist_ok=True)
+        temp_file.write_text(serialized, encoding='utf-8')
+        os.replace(temp_file, cache_file)
+    except OSError as e:
+        cli.log.debug('Could not write info.json cache file %s: %s', cache_file, e)
+
+
+def cached_info_json(resolve, keyboard, force_layout=None):
+    """Returns the info.json data for a keyboard from the cache, resolving and caching it if it's missing or stale.
+
+    Resolutions which logged errors aren't cached, so those errors are reported every time. Warnings are stored along
+    with the data, and logged again when it is read back.
+
+    Args:
+        resolve: function resolving the info.json data, given a keyboard and a forced layout
+
+        keyboard: name of the keyboard
+
+        force_layout: community layout to force, if any
+    """
+    if truthy(os.environ.get('SKIP_INFO_CACHE'), False):
+        return resolve(keyboard, force_layout)
+
+    keyboard = str(keyboard)
+
+    entry = _load(keyboard, force_layout)
+    if entry:
+        for message in entry['warnings']:
+            cli.log.warning('%s', message)
+        return entry['info']
+
+    capture = _LogCapture()
+    cli.log.addHandler(capture)
+    try:
+        info_data = resolve(keyboard, force_layout)
+    finally:
+        cli.log.removeHandler(capture)
+
+    if not any(record.levelno >= logging.ERROR for record in capture.records):
+        warnings = [record.getMessage() for record in capture.records if record.levelno == logging.WARNING]
+        _store(keyboard, force_layout, info_data, warnings)
+
+    return info_data
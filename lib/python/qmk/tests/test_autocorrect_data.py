@@ -0,0 +1,83 @@
+from qmk.cli.generate.autocorrect_data import make_trie, serialize_trie
+
+KC_A = 0x04
+KC_B = 0x05
+KC_Q = 0x14
+KC_X = 0x1b
+KC_Z = 0x1d
+BRANCH = 64  # Set on the first keycode of a branch entry
+
+
+def serialize(autocorrections, link_bytes=None):
+    return serialize_trie(autocorrections, make_trie(autocorrections), link_bytes)
+
+
+def test_single_typo():
+    # A chain of the typo's keycodes in reverse, followed by the leaf: 2 backspaces and "z"
+    assert serialize([('qxza', 'qz')]) == ([KC_A, KC_Z, KC_X, KC_Q, 0, 128 + 2, ord('z'), 0], 2)
+
+
+def test_identical_subtrees_are_shared():
+    data, link_bytes = serialize([('qxza', 'qz'), ('qxzb', 'qz')])
+
+    assert link_bytes == 2
+    assert data == [
+        # 0: root branch, both of which link to the same chain
+        KC_A | BRANCH, 7, 0, KC_B, 7, 0, 0,
+        # 7: chain
+        KC_Z, KC_X, KC_Q, 0,
+        # 11: leaf
+        128 + 2, ord('z'), 0,
+    ]  # yapf: disable
+
+
+def test_link_into_middle_of_chain():
+    data, _ = serialize([('qxza', 'qz'), ('qxb', 'z')])
+
+    assert data == [
+        # 0: root branch, where "b" links to the "x" within the chain of "a"
+        KC_A | BRANCH, 7, 0, KC_B, 8, 0, 0,
+        # 7: chain
+        KC_Z, KC_X, KC_Q, 0,
+        # 11: leaf
+        128 + 2, ord('z'), 0,
+    ]  # yapf: disable
+
+
+def test_different_corrections_are_not_shared():
+    data, _ = serialize([('qxza', 'qz'), ('qxzb', 'qy')])
+
+    assert data == [
+        KC_A | BRANCH, 7, 0, KC_B, 14, 0, 0,
+        # 7: chain and leaf of "a"
+        KC_Z, KC_X, KC_Q, 0, 128 + 2, ord('z'), 0,
+        # 14: chain and leaf of "b"
+        KC_Z, KC_X, KC_Q, 0, 128 + 2, ord('y'), 0,
+    ]  # yapf: disable
+
+
+def test_24_bit_links():
+    data, link_bytes = serialize([('qxza', 'qz'), ('qxzb', 'qz')], 3)
+
+    assert link_bytes == 3
+    assert data == [
+        # 0: root branch, now with three bytes per link
+        KC_A | BRANCH, 9, 0, 0, KC_B, 9, 0, 0, 0,
+        # 9: chain
+        KC_Z, KC_X, KC_Q, 0,
+        # 13: leaf
+        128 + 2, ord('z'), 0,
+    ]  # yapf: disable
+
+
+def test_large_dictionary_switches_to_24_bit_links():
+    # Distinct corrections keep the leaves from being shared
+    letters = 'abcdefghijklmnopqrstuvwxyz'
+    prefixes = [a + b + c for a in letters for b in letters for c in letters[:8]]
+    autocorrections = [(f'{prefix}qxqxqx', f'{prefix}{n:010}') for n, prefix in enumerate(prefixes)]
+
+    assert serialize(autocorrections[:100])[1] == 2
+
+    data, link_bytes = serialize(autocorrections)
+    assert link_bytes == 3
+    assert len(data) > 0xffff
@@ -311,6 +311,16 @@ def test_generate_rules_mk():
     assert 'MCU ?= atmega32u4' in result.stdout
 
 
+def test_generate_leader_sequences_h():
+    result = check_subcommand('generate-leader-sequences-h', 'lib/python/qmk/tests/leader_keymap.json')
+    check_returncode(result)
+    assert '#define LEADER_SEQUENCES_MAX_LENGTH 3' in result.stdout
+    assert '#define LEADER_SEQUENCES_TRIE_SIZE 18' in result.stdout
+    assert '    2, KC_NO, KC_F, 6, KC_G, 10, // root' in result.stdout
+    assert '    0, C(KC_C), // KC_G' in result.stdout
+    assert '    1, KC_1, KC_S, 16, // KC_F, KC_D' in result.stdout
+
+
 def test_generate_version_h():
     result = check_subcommand('generate-version-h')
     check_returncode(result)
@@ -0,0 +1,88 @@
+import logging
+import os
+import tempfile
+from contextlib import contextmanager
+from pathlib import Path
+
+from milc import cli
+
+import qmk.info_cache
+
+
+class LogCapture(logging.Handler):
+    def __init__(self):
+        super().__init__(logging.DEBUG)
+        self.messages = []
+
+    def emit(self, record):
+        self.messages.append(record.getMessage())
+
+
+@contextmanager
+def fake_tree():
+    """Runs in an empty tree holding only a keyboard, with its own cache directory.
+    """
+    cwd = os.getcwd()
+    cache_dir = qmk.info_cache.CACHE_DIR
+    with tempfile.TemporaryDirectory() as tmp:
+        os.chdir(tmp)
+        qmk.info_cache.CACHE_DIR = Path(tmp) / 'cache'
+        qmk.info_cache._global_signature.cache_clear()
+        try:
+            Path('keyboards/pytest').mkdir(parents=True)
+            Path('keyboards/pytest/keyboard.json').write_text('{}')
+            yield
+        finally:
+            os.chdir(cwd)
+            qmk.info_cache.CACHE_DIR = cache_dir
+            qmk.info_cache._global_signature.cache_clear()
+
+
+def counting_resolver(info_data):
+    calls = []
+
+    def resolve(keyboard, force_layout):
+        calls.append(keyboard)
+        return info_data
+
+    return resolve, calls
+
+
+def test_entry_is_reused_until_keyboard_changes():
+    with fake_tree():
+        resolve, calls = counting_resolver({'keyboard_folder': 'pytest'})
+
+        qmk.info_cache.cached_info_json(resolve, 'pytest')
+        qmk.info_cache.cached_info_json(resolve, 'pytest')
+        assert len(calls) == 1
+
+        Path('keyboards/pytest/config.h').write_text('#pragma once\n')
+        qmk.info_cache.cached_info_json(resolve, 'pytest')
+        assert len(calls) == 2
+
+
+def test_community_layouts_are_part_of_the_key():
+    with fake_tree():
+        key = qmk.info_cache._cache_key('pytest', 'pytest', None)
+
+        Path('layouts/default/ortho_4x4').mkdir(parents=True)
+        qmk.info_cache._global_signature.cache_clear()
+        assert qmk.info_cache._cache_key('pytest', 'pytest', None) != key
+
+
+def test_data_changed_by_json_is_not_cached():
+    with fake_tree():
+        resolve, calls = counting_resolver({'keyboard_folder': 'pytest', 'matrix': (1, 2)})
+        capture = LogCapture()
+        cli.log.addHandler(capture)
+        level = cli.log.level
+        cli.log.setLevel(logging.DEBUG)
+        try:
+            qmk.info_cache.cached_info_json(resolve, 'pytest')
+            qmk.info_cache.cached_info_json(resolve, 'pytest')
+        finally:
+            cli.log.removeHandler(capture)
+            cli.log.setLevel(level)
+
+        assert len(calls) == 2
+        assert 'Not caching info.json data for pytest, as it changes when stored as JSON' in capture.messages
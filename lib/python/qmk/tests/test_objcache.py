@@ -0,0 +1,69 @@
+import importlib.util
+import os
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+OBJCACHE = Path(__file__).resolve().parents[4] / 'util' / 'objcache.py'
+
+spec = importlib.util.spec_from_file_location('objcache', OBJCACHE)
+objcache = importlib.util.module_from_spec(spec)
+spec.loader.exec_module(objcache)
+
+# Stands in for the compiler: "preprocessing" prints the source, "compiling" copies it into the object
+FAKE_COMPILER = f"""#!{sys.executable}
+import sys
+args = sys.argv[1:]
+source = next(arg for arg in args if arg.endswith('.c'))
+contents = open(source, 'rb').read()
+if '-E' in args:
+    sys.stdout.buffer.write(contents)
+else:
+    open(args[args.index('-o') + 1], 'wb').write(b'object of ' + contents)
+"""
+
+
+def test_parse_leaves_out_preprocessor_flags():
+    args = ['-c', '-Ikeyboards/a', '-I', 'keyboards/a/keymaps/b', '-iquote', 'q', '-isystem', 's', '-include', '.build/obj_a_b/src/config.h', '-imacros', 'm.h', '-DKEYBOARD_a', '-D', 'QMK_KEYMAP="b"', '-UX', '-Os', 't.c', '-o', 't.o']
+    assert objcache.parse(args) == ('t.o', 't.c', ['-Os'])
+
+
+def test_parse_normalizes_listings():
+    args = ['-c', '-Wa,-adhlns=.build/obj_a_b/t.lst,--listing-cont-lines=100', 't.c', '-o', 't.o']
+    assert objcache.parse(args) == ('t.o', 't.c', ['-Wa,-adhlns,--listing-cont-lines=100'])
+
+
+def test_parse_leaves_out_dependency_flags():
+    args = ['-c', '-MMD', '-MP', '-MF', '.build/obj_a_b/t.d', 't.c', '-o', 't.o', '-mcpu=cortex-m4']
+    assert objcache.parse(args) == ('t.o', 't.c', ['-mcpu=cortex-m4'])
+
+
+def test_parse_rejects_other_commands():
+    assert objcache.parse(['-E', 't.c', '-o', 't.i']) is None
+    assert objcache.parse(['t.c', '-o', 't.elf']) is None
+    assert objcache.parse(['-c', 't.c', 'u.c', '-o', 't.o']) is None
+
+
+def test_targets_share_objects():
+    with tempfile.TemporaryDirectory() as tmp:
+        compiler = os.path.join(tmp, 'cc')
+        with open(compiler, 'w') as f:
+            f.write(FAKE_COMPILER)
+        os.chmod(compiler, 0o755)
+        with open(os.path.join(tmp, 't.c'), 'w') as f:
+            f.write('int x;\n')
+
+        def compile(*args):
+            env = {**os.environ, 'QMK_OBJCACHE_DIR': os.path.join(tmp, 'cache')}
+            subprocess.run([sys.executable, str(OBJCACHE), compiler, '-c', 't.c', *args], cwd=tmp, env=env, check=True)
+
+        os.makedirs(os.path.join(tmp, 'cache'))
+        compile('-Ia', '-DKEYBOARD_a', '-Wa,-adhlns=a.lst', '-o', 'a.o')
+        compile('-Ib', '-DKEYBOARD_b', '-Wa,-adhlns=b.lst', '-o', 'b.o')
+        compile('-Ib', '-O2', '-o', 'c.o')
+
+        with open(os.path.join(tmp, 'cache', 'stats')) as f:
+            assert f.read().split('\n') == ['miss t.c', 'hit t.c', 'miss t.c', '']
+        with open(os.path.join(tmp, 'b.o'), 'rb') as f:
+            assert f.read() == b'object of int x;\n'
@@ -0,0 +1,66 @@
+import struct
+
+from qmk.deferred_print import DeferredPrintDecoder, FirmwareImage, EM_AVR, SHF_ALLOC
+
+EM_ARM = 40
+SHT_PROGBITS = 1
+
+
+def make_elf(machine, sections):
+    """Builds a minimal 32 bit little-endian .elf file holding `sections`, a list of (address, contents).
+    """
+    header_size = 52
+    section_header_size = 40
+    contents = b''.join(data for _, data in sections)
+    shoff = header_size + len(contents)
+
+    elf = bytearray(b'\x7fELF' + bytes([1, 1, 1]) + bytes(9))
+    elf += struct.pack('<HHIIIIIHHHHHH', 2, machine, 1, 0, 0, shoff, 0, header_size, 0, 0, section_header_size, len(sections) + 1, 0)
+    elf += contents
+    elf += bytes(section_header_size)
+    offset = header_size
+    for address, data in sections:
+        elf += struct.pack('<IIIIIIIIII', 0, SHT_PROGBITS, SHF_ALLOC, address, offset, len(data), 0, 0, 1, 0)
+        offset += len(data)
+    return bytes(elf)
+
+
+def arm_decoder():
+    rodata = b'matrix %02X %u %d\n\0b:%08b %s %c\0text\0'
+    return DeferredPrintDecoder(FirmwareImage(make_elf(EM_ARM, [(0x08001000, rodata)])))
+
+
+def test_arm_record():
+    record = struct.pack('<IIIi', 0x08001000, 0xAB, 300, -5)
+    assert arm_decoder().decode_record(record) == 'matrix AB 300 -5\n'
+
+
+def test_arm_binary_string_and_char():
+    record = struct.pack('<IIII', 0x08001013, 0x5, 0x08001020, ord('x'))
+    assert arm_decoder().decode_record(record) == 'b:00000101 text x'
+
+
+def test_unknown_string_argument():
+    record = struct.pack('<IIII', 0x08001013, 0x5, 0x20000000, ord('x'))
+    assert arm_decoder().decode_record(record) == 'b:00000101 <0x20000000> x'
+
+
+def test_avr_sizes():
+    flash = b'\0\0%u %lu %s\n\0'
+    data = b'ram\0'
+    decoder = DeferredPrintDecoder(FirmwareImage(make_elf(EM_AVR, [(0x0, flash), (0x800100, data)])))
+    record = struct.pack('<HHIH', 0x2, 65535, 70000, 0x100)
+    assert decoder.decode_record(record) == '65535 70000 ram\n'
+
+
+def test_dropped_and_unknown_records():
+    decoder = arm_decoder()
+    assert decoder.decode_record(struct.pack('<IB', 0, 3)) == '<3 deferred print records dropped>\n'
+    assert decoder.decode_record(struct.pack('<I', 0x1234)) == '<unknown deferred print format 0x1234>\n'
+
+
+def test_decode_line():
+    decoder = arm_decoder()
+    record = struct.pack('<IIIi', 0x08001000, 1, 2, 3).hex().upper()
+    assert decoder.decode_line('plain text\n') == 'plain text\n'
+    assert decoder.decode_line(f'Keyboard: ~L{record}\n') == 'Keyboard: matrix 01 2 3\n'
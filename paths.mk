@@ -21,6 +21,9 @@ PROTOCOL_PATH = $(TMK_DIR)/$(PROTOCOL_DIR)
 BUILDDEFS_DIR = builddefs
 BUILDDEFS_PATH = $(BUILDDEFS_DIR)
 
+BENCH_DIR = tests/bench
+BENCH_PATH = $(BENCH_DIR)
+
 BUILD_DIR := .build
 
 COMMON_VPATH := $(TOP_DIR)
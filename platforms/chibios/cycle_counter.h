@@ -0,0 +1,52 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <ch.h>
+#include <hal.h>
+
+/*
+ * Counts core clock cycles, using the DWT cycle counter where the core has one.
+ *
+ * Cortex-M0 and M0+ cores don't, so their SysTick is used instead, which only
+ * works if ChibiOS isn't using it as its system timer. The SysTick counter is
+ * 24 bits wide, so measurements on those cores must not exceed 2^24 cycles.
+ */
+
+#if defined(QMK_MCU_ARCH_CORTEX_M0) || defined(QMK_MCU_ARCH_CORTEX_M0PLUS)
+#    if CH_CFG_ST_TIMEDELTA == 0
+#        error "Counting cycles on Cortex-M0/M0+ needs SysTick, which ChibiOS uses for its system tick when CH_CFG_ST_TIMEDELTA is 0. Enable tick-less mode in chconf.h."
+#    endif
+#    define CYCLE_COUNTER_MASK SysTick_LOAD_RELOAD_Msk
+#else
+#    define CYCLE_COUNTER_MASK UINT32_MAX
+#endif
+
+static inline void cycle_counter_init(void) {
+#if defined(QMK_MCU_ARCH_CORTEX_M0) || defined(QMK_MCU_ARCH_CORTEX_M0PLUS)
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL  = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+#else
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#    if defined(QMK_MCU_ARCH_CORTEX_M7)
+    DWT->LAR = 0xC5ACCE55;
+#    endif
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+static inline uint32_t cycle_counter_read(void) {
+#if defined(QMK_MCU_ARCH_CORTEX_M0) || defined(QMK_MCU_ARCH_CORTEX_M0PLUS)
+    // SysTick counts down
+    return SysTick_LOAD_RELOAD_Msk - SysTick->VAL;
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+static inline uint32_t cycle_counter_elapsed(uint32_t start) {
+    return (cycle_counter_read() - start) & CYCLE_COUNTER_MASK;
+}
@@ -0,0 +1,132 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * Cycle counting firmware.
+ *
+ * Replaces the main loop of the firmware, so that the cost of its hot paths,
+ * as built for the keyboard's own MCU, can be measured under an emulator such
+ * as Renode, or on a board with a debugger attached. Each task is called
+ * CYCLES_CALLS times, and the median, fastest and slowest calls are reported
+ * as JSON through semihosting, after which the emulator is asked to exit.
+ */
+
+#include <stdint.h>
+#include "cycle_counter.h"
+#include "keyboard.h"
+#include "matrix.h"
+#include "printf.h"
+#include "util.h"
+
+#ifdef RGB_MATRIX_ENABLE
+#    include "rgb_matrix.h"
+#endif
+#ifdef LED_MATRIX_ENABLE
+#    include "led_matrix.h"
+#endif
+#ifdef RGBLIGHT_ENABLE
+#    include "rgblight.h"
+#endif
+
+#ifndef CYCLES_CALLS
+#    define CYCLES_CALLS 500
+#endif
+
+#define SEMIHOSTING_SYS_WRITE0 0x04
+#define SEMIHOSTING_SYS_EXIT 0x18
+#define SEMIHOSTING_APPLICATION_EXIT 0x20026
+
+void platform_setup(void);
+
+typedef struct {
+    const char *name;
+    void (*task)(void);
+} cycles_task_t;
+
+static void matrix_scan_task(void) {
+    matrix_scan();
+}
+
+#ifdef QUANTUM_PAINTER_ENABLE
+void qp_internal_task(void);
+#endif
+
+static const cycles_task_t cycles_tasks[] = {
+    {"matrix_scan", matrix_scan_task},
+    {"keyboard_task", keyboard_task},
+    {"housekeeping_task", housekeeping_task},
+#ifdef RGBLIGHT_ENABLE
+    {"rgblight_task", rgblight_task},
+#endif
+#ifdef LED_MATRIX_ENABLE
+    {"led_matrix_task", led_matrix_task},
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    {"rgb_matrix_task", rgb_matrix_task},
+#endif
+#ifdef QUANTUM_PAINTER_ENABLE
+    {"qp_internal_task", qp_internal_task},
+#endif
+};
+
+static uint32_t samples[CYCLES_CALLS];
+
+static int semihosting_call(int operation, uintptr_t argument) {
+    register int       r0 __asm__("r0") = operation;
+    register uintptr_t r1 __asm__("r1") = argument;
+    __asm__ volatile("bkpt 0xAB" : "+r"(r0) : "r"(r1) : "memory");
+    return r0;
+}
+
+static void semihosting_write(const char *str) {
+    semihosting_call(SEMIHOSTING_SYS_WRITE0, (uintptr_t)str);
+}
+
+static void sort_samples(void) {
+    for (uint16_t i = 1; i < CYCLES_CALLS; i++) {
+        uint32_t sample = samples[i];
+        uint16_t j      = i;
+        for (; j > 0 && samples[j - 1] > sample; j--) {
+            samples[j] = samples[j - 1];
+        }
+        samples[j] = sample;
+    }
+}
+
+static void empty_task(void) {}
+
+// Sorted cycle counts of the given task, less the cost of measuring them
+static void measure(void (*task)(void), uint32_t overhead) {
+    for (uint16_t i = 0; i < CYCLES_CALLS; i++) {
+        uint32_t start = cycle_counter_read();
+        task();
+        uint32_t elapsed = cycle_counter_elapsed(start);
+        samples[i]       = elapsed > overhead ? elapsed - overhead : 0;
+    }
+    sort_samples();
+}
+
+int main(void) {
+    char line[160];
+
+    platform_setup();
+    keyboard_setup();
+    keyboard_init();
+    cycle_counter_init();
+
+    measure(empty_task, 0);
+    uint32_t overhead = samples[0];
+
+    snprintf(line, sizeof(line), "{\n    \"suite\": \"%s:%s\",\n    \"benchmarks\": [", QMK_KEYBOARD, QMK_KEYMAP);
+    semihosting_write(line);
+    for (uint8_t i = 0; i < ARRAY_SIZE(cycles_tasks); i++) {
+        measure(cycles_tasks[i].task, overhead);
+        snprintf(line, sizeof(line), "%s\n        {\"name\": \"%s\", \"iterations\": %u, \"cycles_per_op\": %lu, \"min_cycles_per_op\": %lu, \"max_cycles_per_op\": %lu}", i ? "," : "", cycles_tasks[i].name, CYCLES_CALLS, (unsigned long)samples[CYCLES_CALLS / 2], (unsigned long)samples[0], (unsigned long)samples[CYCLES_CALLS - 1]);
+        semihosting_write(line);
+    }
+    semihosting_write("\n    ]\n}\n");
+
+    semihosting_call(SEMIHOSTING_SYS_EXIT, SEMIHOSTING_APPLICATION_EXIT);
+    while (true) {
+    }
+}
@@ -32,6 +32,9 @@
   it is also possible to have a custom sample-LUT by implementing/overriding 'dac_value_generate'
 
   this driver allows for multiple simultaneous tones to be played through one single channel by doing additive wave-synthesis
+
+  with AUDIO_DAC_MIXER defined, the samples are instead rendered ahead of time by the fixed-point mixer (see quantum/audio/audio_mixer.c)
+  from a dedicated thread, and the DMA callback only copies finished blocks into the DAC buffer
 */
 
 #if !defined(AUDIO_PIN)
@@ -90,6 +93,110 @@ static const dacsample_t dac_buffer_trapezoid[] = {
 
 static dacsample_t dac_buffer[AUDIO_DAC_BUFFER_SIZE];
 
+#if defined(AUDIO_DAC_MIXER)
+#    include <string.h>
+#    include "audio_mixer.h"
+
+#    ifndef AUDIO_DAC_MIXER_BLOCKS
+#        define AUDIO_DAC_MIXER_BLOCKS 4
+#    endif
+#    define AUDIO_DAC_MIXER_BLOCK_SIZE (AUDIO_DAC_BUFFER_SIZE / 2)
+
+#    if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
+#        define AUDIO_DAC_MIXER_WAVETABLE dac_buffer_sine
+#    elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
+#        define AUDIO_DAC_MIXER_WAVETABLE dac_buffer_triangle
+#    elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
+#        define AUDIO_DAC_MIXER_WAVETABLE dac_buffer_trapezoid
+#    elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
+#        define AUDIO_DAC_MIXER_WAVETABLE dac_buffer_square
+#    endif
+
+_Static_assert((ARRAY_SIZE(AUDIO_DAC_MIXER_WAVETABLE) & (ARRAY_SIZE(AUDIO_DAC_MIXER_WAVETABLE) - 1)) == 0, "AUDIO_DAC_MIXER requires a wavetable whose length is a power of two");
+
+static const audio_mixer_config_t mixer_config = {
+    // the GPT runs at 3*AUDIO_DAC_SAMPLE_RATE, and triggers a conversion every other tick
+    .sample_rate = AUDIO_DAC_SAMPLE_RATE * 3 / 2,
+    .wavetable   = AUDIO_DAC_MIXER_WAVETABLE,
+    // a single voice at full level plays the wavetable as is, like the additive synthesis does
+    .wavetable_bits   = __builtin_ctz(ARRAY_SIZE(AUDIO_DAC_MIXER_WAVETABLE)),
+    .wavetable_center = AUDIO_DAC_OFF_VALUE,
+    .off_value        = AUDIO_DAC_OFF_VALUE,
+    .sample_max       = AUDIO_DAC_SAMPLE_MAX,
+};
+
+/* FIFO of rendered blocks, filled by the mixer thread and drained by the DMA callback */
+static dacsample_t      mixer_blocks[AUDIO_DAC_MIXER_BLOCKS][AUDIO_DAC_MIXER_BLOCK_SIZE];
+static uint8_t          mixer_head   = 0;
+static uint8_t          mixer_tail   = 0;
+static volatile uint8_t mixer_filled = 0;
+// set by audio_driver_stop_impl, while the last tones fade out
+static volatile bool mixer_stopping = false;
+// set once everything has faded out, after which the timer is stopped as soon as the FIFO is empty
+static volatile bool mixer_idle = true;
+static binary_semaphore_t mixer_semaphore;
+
+static THD_WORKING_AREA(waAudioMixerThread, 256);
+static THD_FUNCTION(AudioMixerThread, arg) {
+    (void)arg;
+    chRegSetThreadName("audio_mixer");
+    while (true) {
+        chBSemWait(&mixer_semaphore);
+        while (mixer_filled < AUDIO_DAC_MIXER_BLOCKS && !mixer_idle) {
+            // update audio internal state (note position, current_note, ...)
+            audio_mixer_update();
+            audio_mixer_render(mixer_blocks[mixer_head], AUDIO_DAC_MIXER_BLOCK_SIZE);
+            mixer_head = (mixer_head + 1) % AUDIO_DAC_MIXER_BLOCKS;
+
+            chSysLock();
+            mixer_filled++;
+            if (mixer_stopping && audio_mixer_is_silent()) {
+                mixer_idle = true;
+            }
+            chSysUnlock();
+        }
+    }
+}
+
+/**
+ * DAC streaming callback. Hands the next rendered block over to the DMA, and wakes
+ * the mixer thread up to render another one.
+ *
+ * Note: chibios calls this CB twice: during the 'half buffer event', and the 'full buffer event'.
+ */
+static void dac_end(DACDriver *dacp) {
+    dacsample_t *sample_p = (dacp)->samples;
+
+    // work on the other half of the buffer
+    if (dacIsBufferComplete(dacp)) {
+        sample_p += AUDIO_DAC_BUFFER_SIZE / 2; // 'half_index'
+    }
+
+    static uint8_t off_blocks = 0;
+
+    chSysLockFromISR();
+    if (mixer_filled > 0) {
+        memcpy(sample_p, mixer_blocks[mixer_tail], sizeof(mixer_blocks[0]));
+        mixer_tail = (mixer_tail + 1) % AUDIO_DAC_MIXER_BLOCKS;
+        mixer_filled--;
+        off_blocks = 0;
+    } else {
+        // either the mixer thread fell behind, or everything has been played
+        for (uint16_t s = 0; s < AUDIO_DAC_MIXER_BLOCK_SIZE; s++) {
+            sample_p[s] = AUDIO_DAC_OFF_VALUE;
+        }
+        // trailing off: once both halves of the buffer only hold AUDIO_DAC_OFF_VALUE, stopping
+        // timer6 = stopping the DAC at whatever value it is currently pushing to the output
+        if (mixer_idle && ++off_blocks >= 2) {
+            off_blocks = 0;
+            gptStopTimerI(&GPTD6);
+        }
+    }
+    chBSemSignalI(&mixer_semaphore);
+    chSysUnlockFromISR();
+}
+#else // AUDIO_DAC_MIXER
+
 /* keep track of the sample position for for each frequency */
 static float dac_if[AUDIO_MAX_SIMULTANEOUS_TONES] = {0.0};
 
@@ -272,6 +379,7 @@ static void dac_end(DACDriver *dacp) {
         }
     }
 }
+#endif // AUDIO_DAC_MIXER
 
 static void dac_error(DACDriver *dacp, dacerror_t err) {
     (void)dacp;
@@ -304,6 +412,12 @@ static const DACConfig dac_conf = {.init = AUDIO_DAC_OFF_VALUE, .datamode = DAC_
 static const DACConversionGroup dac_conv_cfg = {.num_channels = 1U, .end_cb = dac_end, .error_cb = dac_error, .trigger = DAC_TRG(0b000)};
 
 void audio_driver_initialize_impl(void) {
+#if defined(AUDIO_DAC_MIXER)
+    audio_mixer_init(&mixer_config);
+    chBSemObjectInit(&mixer_semaphore, true);
+    chThdCreateStatic(waAudioMixerThread, sizeof(waAudioMixerThread), NORMALPRIO + 1, AudioMixerThread, NULL);
+#endif
+
     if ((AUDIO_PIN == A4) || (AUDIO_PIN_ALT == A4)) {
         palSetLineMode(A4, PAL_MODE_INPUT_ANALOG);
         dacStart(&DACD1, &dac_conf);
@@ -350,6 +464,32 @@ void audio_driver_initialize_impl(void) {
     gptStart(&GPTD6, &gpt6cfg1);
 }
 
+#if defined(AUDIO_DAC_MIXER)
+void audio_driver_stop_impl(void) {
+    mixer_stopping = true;
+}
+
+void audio_driver_start_impl(void) {
+    chSysLock();
+    bool timer_stopped = (GPTD6.state == GPT_READY);
+    if (timer_stopped) {
+        // the mixer thread is waiting for the idle flag to be cleared, so it's safe to start over
+        audio_mixer_init(&mixer_config);
+        mixer_head   = 0;
+        mixer_tail   = 0;
+        mixer_filled = 0;
+    }
+    mixer_stopping = false;
+    mixer_idle     = false;
+    chBSemSignalI(&mixer_semaphore);
+    chSchRescheduleS();
+    chSysUnlock();
+
+    if (timer_stopped) {
+        gptStartContinuous(&GPTD6, 2U);
+    }
+}
+#else
 void audio_driver_stop_impl(void) {
     state = OUTPUT_SHOULD_STOP;
 }
@@ -364,5 +504,6 @@ void audio_driver_start_impl(void) {
     active_tones_snapshot_length = 0;
     state                        = OUTPUT_SHOULD_START;
 }
+#endif // AUDIO_DAC_MIXER
 
 #pragma GCC diagnostic pop
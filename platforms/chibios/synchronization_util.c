@@ -24,3 +24,22 @@ void split_shared_memory_unlock(void) {
     chMtxUnlock(&SPLIT_SHARED_MEMORY_MUTEX);
 }
 #endif
+
+#if defined(POINTING_DEVICE_MOTION_THREAD)
+static MUTEX_DECL(POINTING_DEVICE_MUTEX);
+
+/**
+ * @brief Acquire exclusive access to the pointing device driver, which is used
+ * from both the main loop and the pointing device motion thread.
+ */
+void pointing_device_lock(void) {
+    chMtxLock(&POINTING_DEVICE_MUTEX);
+}
+
+/**
+ * @brief Release the pointing device mutex that has been acquired before.
+ */
+void pointing_device_unlock(void) {
+    chMtxUnlock(&POINTING_DEVICE_MUTEX);
+}
+#endif
@@ -12,6 +12,11 @@ extern inline void split_shared_memory_unlock(void);
 #    endif
 #endif
 
+#if defined(POINTING_DEVICE_ENABLE) && !defined(POINTING_DEVICE_MOTION_THREAD)
+extern inline void pointing_device_lock(void);
+extern inline void pointing_device_unlock(void);
+#endif
+
 #if defined(SPLIT_KEYBOARD)
 QMK_IMPLEMENT_AUTOUNLOCK_HELPERS(split_shared_memory)
 #endif
@@ -8,6 +8,10 @@
 void split_shared_memory_lock(void);
 void split_shared_memory_unlock(void);
 #    endif
+#    if defined(POINTING_DEVICE_MOTION_THREAD)
+void pointing_device_lock(void);
+void pointing_device_unlock(void);
+#    endif
 #else
 #    if defined(SPLIT_KEYBOARD)
 inline void split_shared_memory_lock(void){};
@@ -15,6 +19,11 @@ inline void split_shared_memory_unlock(void){};
 #    endif
 #endif
 
+#if defined(POINTING_DEVICE_ENABLE) && !defined(POINTING_DEVICE_MOTION_THREAD)
+inline void pointing_device_lock(void){};
+inline void pointing_device_unlock(void){};
+#endif
+
 /* GCCs cleanup attribute expects a function with one parameter, which is a
  * pointer to a type compatible with the variable. As we don't want to expose
  * the platforms internal mutex type this workaround with auto generated adapter
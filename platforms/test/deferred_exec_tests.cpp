@@ -0,0 +1,252 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define TABLE_COUNT 8
+
+struct invocation {
+    uintptr_t id;
+    uint32_t  time;
+};
+
+static std::vector<invocation> invocations;
+static uint32_t                repeat_delay = 0;
+static deferred_token          victim       = INVALID_DEFERRED_TOKEN;
+
+class DeferredExecTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(1000);
+        memset(table, 0, sizeof(table));
+        last_exec    = 0;
+        repeat_delay = 0;
+        victim       = INVALID_DEFERRED_TOKEN;
+        invocations.clear();
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; ++i) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, TABLE_COUNT, &last_exec);
+        }
+    }
+
+    deferred_token defer(uint32_t delay_ms, deferred_exec_callback cb, uintptr_t id) {
+        return defer_exec_advanced(table, TABLE_COUNT, delay_ms, cb, (void *)id);
+    }
+
+    deferred_executor_t table[TABLE_COUNT];
+    uint32_t            last_exec;
+};
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    invocations.push_back({(uintptr_t)cb_arg, timer_read32()});
+    return repeat_delay;
+}
+
+static uint32_t cancelling_callback(uint32_t trigger_time, void *cb_arg) {
+    invocations.push_back({(uintptr_t)cb_arg, timer_read32()});
+    cancel_deferred_exec(victim);
+    return 0;
+}
+
+static deferred_executor_t *victim_table;
+static uint32_t             cancel_victim_callback(uint32_t trigger_time, void *cb_arg) {
+    invocations.push_back({(uintptr_t)cb_arg, timer_read32()});
+    EXPECT_TRUE(cancel_deferred_exec_advanced(victim_table, TABLE_COUNT, victim));
+    return 0;
+}
+
+TEST_F(DeferredExecTest, ExecutesInDeadlineOrder) {
+    const uint32_t delays[] = {30, 10, 50, 20, 40};
+    for (uintptr_t i = 0; i < 5; ++i) {
+        EXPECT_NE(defer(delays[i], record_callback, i), INVALID_DEFERRED_TOKEN);
+    }
+    run_for(60);
+    ASSERT_EQ(invocations.size(), 5);
+    const uintptr_t expected[] = {1, 3, 0, 4, 2};
+    for (size_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(invocations[i].id, expected[i]);
+        EXPECT_EQ(invocations[i].time, 1000 + delays[expected[i]]);
+    }
+}
+
+TEST_F(DeferredExecTest, RepeatsWithReturnedDelay) {
+    repeat_delay = 15;
+    defer(10, record_callback, 7);
+    run_for(45);
+    ASSERT_EQ(invocations.size(), 3);
+    EXPECT_EQ(invocations[0].time, 1010);
+    EXPECT_EQ(invocations[1].time, 1025);
+    EXPECT_EQ(invocations[2].time, 1040);
+}
+
+TEST_F(DeferredExecTest, FullTableRejectsUntilCancelled) {
+    deferred_token tokens[TABLE_COUNT];
+    for (uintptr_t i = 0; i < TABLE_COUNT; ++i) {
+        tokens[i] = defer(100 + i, record_callback, i);
+        EXPECT_NE(tokens[i], INVALID_DEFERRED_TOKEN);
+        for (uintptr_t j = 0; j < i; ++j) {
+            EXPECT_NE(tokens[i], tokens[j]);
+        }
+    }
+    EXPECT_EQ(defer(10, record_callback, 99), INVALID_DEFERRED_TOKEN);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, TABLE_COUNT, tokens[3]));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, TABLE_COUNT, tokens[3]));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, TABLE_COUNT, tokens[3], 10));
+
+    deferred_token replacement = defer(10, record_callback, 99);
+    EXPECT_NE(replacement, INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(replacement, tokens[3]);
+
+    run_for(200);
+    ASSERT_EQ(invocations.size(), TABLE_COUNT);
+    EXPECT_EQ(invocations[0].id, 99);
+    for (size_t i = 1; i < invocations.size(); ++i) {
+        EXPECT_NE(invocations[i].id, 3);
+        EXPECT_LT(invocations[i - 1].time, invocations[i].time);
+    }
+}
+
+TEST_F(DeferredExecTest, ExtendReordersExecution) {
+    deferred_token first = defer(10, record_callback, 1);
+    defer(20, record_callback, 2);
+    run_for(5);
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, TABLE_COUNT, first, 30));
+    run_for(40);
+    ASSERT_EQ(invocations.size(), 2);
+    EXPECT_EQ(invocations[0].id, 2);
+    EXPECT_EQ(invocations[1].id, 1);
+    EXPECT_EQ(invocations[1].time, 1035);
+}
+
+TEST_F(DeferredExecTest, CallbackCanCancelOtherExecutors) {
+    victim_table = table;
+    defer(10, cancel_victim_callback, 1);
+    victim = defer(10, record_callback, 2);
+    defer(20, record_callback, 3);
+    run_for(30);
+    ASSERT_EQ(invocations.size(), 2);
+    EXPECT_EQ(invocations[0].id, 1);
+    EXPECT_EQ(invocations[1].id, 3);
+}
+
+TEST_F(DeferredExecTest, CallbackCanCancelAcrossTables) {
+    victim = defer_exec(10, record_callback, (void *)5);
+    ASSERT_NE(victim, INVALID_DEFERRED_TOKEN);
+    defer(5, cancelling_callback, 4);
+    run_for(20);
+    deferred_exec_task();
+    ASSERT_EQ(invocations.size(), 1);
+    EXPECT_EQ(invocations[0].id, 4);
+}
+
+TEST_F(DeferredExecTest, TokensAreNotReusedWhileQueued) {
+    deferred_token queued = defer(5000, record_callback, 1);
+    for (int i = 0; i < 1000; ++i) {
+        deferred_token token = defer(1, record_callback, 2);
+        ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+        ASSERT_NE(token, queued);
+        run_for(1);
+    }
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, TABLE_COUNT, queued));
+}
+
+// Repeats with the delay given as its argument
+static uint32_t periodic_callback(uint32_t trigger_time, void *cb_arg) {
+    invocations.push_back({(uintptr_t)cb_arg, timer_read32()});
+    return (uint32_t)(uintptr_t)cb_arg;
+}
+
+TEST_F(DeferredExecTest, ExecutorBehindDoesNotStarveOthers) {
+    // With the main loop only getting around every 10ms, the 1ms executor is always behind
+    defer(1, periodic_callback, 1);
+    defer(5, periodic_callback, 20);
+
+    for (uint32_t pass = 0; pass < 10; ++pass) {
+        invocations.clear();
+        advance_time(10);
+        deferred_exec_advanced_task(table, TABLE_COUNT, &last_exec);
+
+        size_t fast = 0, slow = 0;
+        for (auto &invocation : invocations) {
+            (invocation.id == 1 ? fast : slow)++;
+        }
+        EXPECT_EQ(fast, 1) << "pass " << pass;
+        EXPECT_EQ(slow, pass % 2 == 0 ? 1 : 0) << "pass " << pass;
+    }
+}
+
+TEST_F(DeferredExecTest, ExecutorsBehindCatchUpInTriggerOrder) {
+    defer(1, periodic_callback, 1);
+    defer(2, periodic_callback, 2);
+
+    // Both are due more than once, but each runs once per pass, earliest trigger first
+    advance_time(10);
+    deferred_exec_advanced_task(table, TABLE_COUNT, &last_exec);
+    ASSERT_EQ(invocations.size(), 2);
+    EXPECT_EQ(invocations[0].id, 1);
+    EXPECT_EQ(invocations[1].id, 2);
+
+    // Then they keep catching up one trigger per pass: the 2ms executor gets back on schedule, the 1ms one can't
+    run_for(20);
+    size_t fast = 0, slow = 0;
+    for (auto &invocation : invocations) {
+        (invocation.id == 1 ? fast : slow)++;
+    }
+    EXPECT_EQ(fast, 21);
+    EXPECT_EQ(slow, 15);
+}
+
+// Cancelling and re-queueing executors over and over keeps a large table in deadline order
+TEST_F(DeferredExecTest, LargeTableChurnKeepsDeadlineOrder) {
+    static const size_t large_count = 64;
+    deferred_executor_t large_table[large_count];
+    deferred_token      tokens[large_count];
+    uint32_t            delays[large_count];
+    uint32_t            large_last_exec = 0;
+    memset(large_table, 0, sizeof(large_table));
+
+    for (uintptr_t i = 0; i < large_count; ++i) {
+        delays[i] = 100 + i;
+        tokens[i] = defer_exec_advanced(large_table, large_count, delays[i], record_callback, (void *)i);
+        ASSERT_NE(tokens[i], INVALID_DEFERRED_TOKEN);
+    }
+    for (uint32_t i = 0; i < 500; ++i) {
+        uintptr_t slot = i % large_count;
+        ASSERT_TRUE(cancel_deferred_exec_advanced(large_table, large_count, tokens[slot]));
+        delays[slot] = 100 + (i * 37) % large_count;
+        tokens[slot] = defer_exec_advanced(large_table, large_count, delays[slot], record_callback, (void *)slot);
+        ASSERT_NE(tokens[slot], INVALID_DEFERRED_TOKEN);
+    }
+
+    for (uint32_t i = 0; i < 200; ++i) {
+        advance_time(1);
+        deferred_exec_advanced_task(large_table, large_count, &large_last_exec);
+        if (i < 99) {
+            EXPECT_TRUE(invocations.empty());
+        }
+    }
+    ASSERT_EQ(invocations.size(), large_count);
+    std::vector<bool> seen(large_count);
+    for (size_t i = 0; i < invocations.size(); ++i) {
+        EXPECT_FALSE(seen[invocations[i].id]);
+        seen[invocations[i].id] = true;
+        EXPECT_EQ(invocations[i].time, 1000 + delays[invocations[i].id]);
+        if (i > 0) {
+            EXPECT_LE(invocations[i - 1].time, invocations[i].time);
+        }
+    }
+}
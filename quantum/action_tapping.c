@@ -1,10 +1,12 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "action.h"
 #include "action_layer.h"
 #include "action_tapping.h"
 #include "keycode.h"
+#include "matrix.h"
 #include "timer.h"
 
 #ifndef NO_ACTION_TAPPING
@@ -98,13 +100,30 @@ __attribute__((weak)) bool get_hold_on_other_key_press(uint16_t keycode, keyreco
 #        include "process_auto_shift.h"
 #    endif
 
+_Static_assert(WAITING_BUFFER_SIZE >= 2 && WAITING_BUFFER_SIZE <= 255, "WAITING_BUFFER_SIZE must be between 2 and 255");
+
 static keyrecord_t tapping_key                         = {};
 static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
 
+/* Index over the buffered events of matrix keys, so that the per-event queries
+ * below don't have to walk the whole buffer. Each key has a bit set for every
+ * direction (press/release) it has buffered events for, and the buffered
+ * events of one key are chained oldest to newest through waiting_buffer_next.
+ * Events for positions outside the matrix (encoders, combos, ...) are not
+ * indexed and fall back to scanning.
+ */
+#    define WAITING_BUFFER_NONE WAITING_BUFFER_SIZE
+static matrix_row_t waiting_buffer_pressed_keys[MATRIX_ROWS]             = {};
+static matrix_row_t waiting_buffer_released_keys[MATRIX_ROWS]            = {};
+static uint8_t      waiting_buffer_newest_slot[MATRIX_ROWS][MATRIX_COLS] = {};
+static uint8_t      waiting_buffer_next[WAITING_BUFFER_SIZE]             = {};
+static uint8_t      waiting_buffer_pressed_count                         = 0;
+
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
+static void waiting_buffer_pop(void);
 static void waiting_buffer_clear(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
@@ -137,7 +156,7 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_pop()) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
@@ -307,7 +326,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     uint8_t first_tap = waiting_buffer_find_chordal_hold_tap();
                     ac_dprintf("first_tap = %u\n", first_tap);
                     if (first_tap < WAITING_BUFFER_SIZE) {
-                        for (; waiting_buffer_tail != first_tap; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+                        for (; waiting_buffer_tail != first_tap; waiting_buffer_pop()) {
                             ac_dprintf("Processing [%u]\n", waiting_buffer_tail);
                             process_record(&waiting_buffer[waiting_buffer_tail]);
                         }
@@ -407,7 +426,7 @@ bool process_tapping(keyrecord_t *keyp) {
                             if (waiting_buffer_tail != waiting_buffer_head && is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
                                 tapping_key = waiting_buffer[waiting_buffer_tail];
                                 // Pop tail from the queue.
-                                waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+                                waiting_buffer_pop();
                                 debug_waiting_buffer();
                             } else
 #    endif // CHORDAL_HOLD
@@ -567,9 +586,16 @@ bool process_tapping(keyrecord_t *keyp) {
     }
 }
 
+/** \brief Whether events for `key` are tracked by the waiting buffer index. */
+static inline bool waiting_buffer_is_indexed(keypos_t key) {
+    return key.row < MATRIX_ROWS && key.col < MATRIX_COLS;
+}
+
 /** \brief Waiting buffer enq
  *
- * FIXME: Needs docs
+ * Appends `record` to the waiting buffer and adds it to the index.
+ *
+ * \return false if the buffer is full, true otherwise.
  */
 bool waiting_buffer_enq(keyrecord_t record) {
     if (IS_NOEVENT(record.event)) {
@@ -581,45 +607,113 @@ bool waiting_buffer_enq(keyrecord_t record) {
         return false;
     }
 
-    waiting_buffer[waiting_buffer_head] = record;
-    waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+    const uint8_t  slot = waiting_buffer_head;
+    const keypos_t key  = record.event.key;
+    if (waiting_buffer_is_indexed(key)) {
+        const matrix_row_t mask = MATRIX_ROW_SHIFTER << key.col;
+        if ((waiting_buffer_pressed_keys[key.row] | waiting_buffer_released_keys[key.row]) & mask) {
+            waiting_buffer_next[waiting_buffer_newest_slot[key.row][key.col]] = slot;
+        }
+        waiting_buffer_newest_slot[key.row][key.col] = slot;
+        if (record.event.pressed) {
+            waiting_buffer_pressed_keys[key.row] |= mask;
+        } else {
+            waiting_buffer_released_keys[key.row] |= mask;
+        }
+    }
+    if (record.event.pressed) {
+        ++waiting_buffer_pressed_count;
+    }
+
+    waiting_buffer[slot]      = record;
+    waiting_buffer_next[slot] = WAITING_BUFFER_NONE;
+    waiting_buffer_head       = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
     return true;
 }
 
-/** \brief Waiting buffer clear
+/** \brief Waiting buffer pop
  *
- * FIXME: Needs docs
+ * Removes the oldest event from the waiting buffer and from the index. The
+ * event itself stays in place until its slot is reused, so callers may still
+ * look at it after popping.
  */
-void waiting_buffer_clear(void) {
-    waiting_buffer_head = 0;
-    waiting_buffer_tail = 0;
+void waiting_buffer_pop(void) {
+    const uint8_t    slot  = waiting_buffer_tail;
+    const keyevent_t event = waiting_buffer[slot].event;
+    const keypos_t   key   = event.key;
+    waiting_buffer_tail    = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+
+    if (event.pressed) {
+        --waiting_buffer_pressed_count;
+    }
+    if (!waiting_buffer_is_indexed(key)) {
+        return;
+    }
+
+    // The popped event is always the oldest one for its key, so the chain
+    // starting at its successor holds all of the key's remaining events.
+    const matrix_row_t mask = MATRIX_ROW_SHIFTER << key.col;
+    if (waiting_buffer_newest_slot[key.row][key.col] == slot) {
+        waiting_buffer_pressed_keys[key.row] &= ~mask;
+        waiting_buffer_released_keys[key.row] &= ~mask;
+        return;
+    }
+    for (uint8_t i = waiting_buffer_next[slot]; i != WAITING_BUFFER_NONE; i = waiting_buffer_next[i]) {
+        if (waiting_buffer[i].event.pressed == event.pressed) {
+            return;
+        }
+    }
+    if (event.pressed) {
+        waiting_buffer_pressed_keys[key.row] &= ~mask;
+    } else {
+        waiting_buffer_released_keys[key.row] &= ~mask;
+    }
 }
 
-/** \brief Waiting buffer typed
+/** \brief Waiting buffer clear
  *
- * FIXME: Needs docs
+ * Drops all buffered events and resets the index.
  */
-bool waiting_buffer_typed(keyevent_t event) {
+void waiting_buffer_clear(void) {
+    waiting_buffer_head          = 0;
+    waiting_buffer_tail          = 0;
+    waiting_buffer_pressed_count = 0;
+    memset(waiting_buffer_pressed_keys, 0, sizeof(waiting_buffer_pressed_keys));
+    memset(waiting_buffer_released_keys, 0, sizeof(waiting_buffer_released_keys));
+}
+
+/** \brief Whether the waiting buffer holds an event for `key` with the given direction. */
+static bool waiting_buffer_contains(keypos_t key, bool pressed) {
+    if (waiting_buffer_is_indexed(key)) {
+        const matrix_row_t *keys = pressed ? waiting_buffer_pressed_keys : waiting_buffer_released_keys;
+        return keys[key.row] & (MATRIX_ROW_SHIFTER << key.col);
+    }
     for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
+        if (KEYEQ(key, waiting_buffer[i].event.key) && pressed == waiting_buffer[i].event.pressed) {
             return true;
         }
     }
     return false;
 }
 
+/** \brief Waiting buffer typed
+ *
+ * Whether the opposite action of `event` (i.e. the release for a press) of
+ * the same key is already in the waiting buffer.
+ */
+bool waiting_buffer_typed(keyevent_t event) {
+    return waiting_buffer_contains(event.key, !event.pressed);
+}
+
 /** \brief Waiting buffer has anykey pressed
  *
- * FIXME: Needs docs
+ * Whether the waiting buffer contains any key press.
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (waiting_buffer[i].event.pressed) return true;
-    }
-    return false;
+    return waiting_buffer_pressed_count > 0;
 }
 
 /** \brief Scan buffer for tapping
@@ -630,7 +724,8 @@ void waiting_buffer_scan_tap(void) {
     // early return if:
     // - tapping already is settled
     // - invalid state: tapping_key released && tap.count == 0
-    if ((tapping_key.tap.count > 0) || !tapping_key.event.pressed) {
+    // - the release of tapping_key hasn't been buffered yet
+    if ((tapping_key.tap.count > 0) || !tapping_key.event.pressed || !waiting_buffer_contains(tapping_key.event.key, false)) {
         return;
     }
 
@@ -741,7 +836,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
             registered_taps_add(record->event.key);
         }
         process_record(record);
-        waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+        waiting_buffer_pop();
 
         if (KEYEQ(key, record->event.key) && record->event.pressed) {
             break;
@@ -750,7 +845,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
 }
 
 static void waiting_buffer_process_regular(void) {
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_pop()) {
         if (is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
             break; // Stop once a tap-hold key event is reached.
         }
@@ -0,0 +1,157 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * Fixed-point wavetable mixer.
+ *
+ * Each voice walks the wavetable with a 32-bit phase accumulator, whose top
+ * bits index the table, and is scaled by its own linear attack/release
+ * envelope. Frequencies are only converted from floats when the set of tones
+ * changes, so rendering a block of samples is integer-only and cheap enough to
+ * be done ahead of time, away from the output ISR.
+ */
+
+#include "audio_mixer.h"
+#include "util.h"
+
+#define LEVEL_BITS 15
+#define LEVEL_MAX (1UL << LEVEL_BITS)
+
+// Keeps the weighted sum of all voices within an int32_t, even for a wavetable spanning 0 to 4095 around a center of 0
+_Static_assert(AUDIO_MIXER_VOICES <= 16, "AUDIO_MIXER_VOICES must be at most 16");
+
+typedef struct {
+    uint32_t phase;
+    uint32_t increment; // phase advance per sample, a full period being 2^32
+    uint32_t level;     // envelope, from 0 to LEVEL_MAX
+    bool     on;        // attacking or sustaining, otherwise releasing
+} audio_mixer_voice_t;
+
+static const audio_mixer_config_t *mixer_config = NULL;
+static audio_mixer_voice_t         voices[AUDIO_MIXER_VOICES];
+static uint32_t                    attack_step   = LEVEL_MAX;
+static uint32_t                    release_step  = LEVEL_MAX;
+static bool                        tones_pending = true;
+
+static uint32_t envelope_step(uint32_t duration_ms) {
+    uint32_t samples = mixer_config->sample_rate * duration_ms / 1000;
+    return samples > 0 ? MAX(LEVEL_MAX / samples, 1) : LEVEL_MAX;
+}
+
+static uint32_t frequency_to_increment(float frequency) {
+    // Rounding to 1/256 Hz first keeps the result independent of the FPU's precision
+    uint32_t frequency_q8 = (uint32_t)(frequency * 256.0f + 0.5f);
+    return ((uint64_t)frequency_q8 << 24) / mixer_config->sample_rate;
+}
+
+void audio_mixer_init(const audio_mixer_config_t *config) {
+    mixer_config = config;
+    for (uint8_t i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        voices[i] = (audio_mixer_voice_t){0};
+    }
+    attack_step   = envelope_step(AUDIO_MIXER_ATTACK_MS);
+    release_step  = envelope_step(AUDIO_MIXER_RELEASE_MS);
+    tones_pending = true;
+}
+
+void audio_mixer_set_tones(const float *frequencies, uint8_t count) {
+    uint32_t increments[AUDIO_MIXER_VOICES];
+    bool     assigned[AUDIO_MIXER_VOICES] = {false};
+
+    count = MIN(count, AUDIO_MIXER_VOICES);
+    for (uint8_t i = 0; i < count; i++) {
+        increments[i] = frequency_to_increment(frequencies[i]);
+    }
+
+    // Tones that are already playing (or still fading out) keep their voice and phase
+    for (uint8_t v = 0; v < AUDIO_MIXER_VOICES; v++) {
+        voices[v].on = false;
+        for (uint8_t i = 0; i < count; i++) {
+            if (!assigned[i] && voices[v].level > 0 && voices[v].increment == increments[i]) {
+                voices[v].on = true;
+                assigned[i]  = true;
+                break;
+            }
+        }
+    }
+
+    // New tones take over the quietest voice that isn't otherwise needed
+    for (uint8_t i = 0; i < count; i++) {
+        if (assigned[i]) {
+            continue;
+        }
+        audio_mixer_voice_t *quietest = NULL;
+        for (uint8_t v = 0; v < AUDIO_MIXER_VOICES; v++) {
+            if (!voices[v].on && (quietest == NULL || voices[v].level < quietest->level)) {
+                quietest = &voices[v];
+            }
+        }
+        if (quietest->level == 0) {
+            quietest->phase = 0;
+        }
+        quietest->increment = increments[i];
+        quietest->on        = true;
+    }
+}
+
+void audio_mixer_update(void) {
+    // Tones only need to be fetched again when something changed, or to fade out after audio_stop_all
+    if (!audio_update_state() && !tones_pending && audio_get_number_of_active_tones() > 0) {
+        return;
+    }
+    tones_pending = false;
+
+    float   frequencies[AUDIO_MIXER_VOICES];
+    uint8_t count  = 0;
+    uint8_t active = MIN(AUDIO_MIXER_VOICES, audio_get_number_of_active_tones());
+    for (uint8_t i = 0; i < active; i++) {
+        float frequency = audio_get_processed_frequency(i);
+        // Rests have a frequency of 0 and would only lower the volume of the other tones
+        if (frequency > 0.0f) {
+            frequencies[count++] = frequency;
+        }
+    }
+    audio_mixer_set_tones(frequencies, count);
+}
+
+void audio_mixer_render(uint16_t *samples, size_t count) {
+    const uint16_t *wavetable = mixer_config->wavetable;
+    const uint8_t   shift     = 32 - mixer_config->wavetable_bits;
+    const int32_t   center    = mixer_config->wavetable_center;
+
+    for (size_t s = 0; s < count; s++) {
+        int32_t mix   = 0;
+        int32_t total = 0;
+
+        for (uint8_t v = 0; v < AUDIO_MIXER_VOICES; v++) {
+            audio_mixer_voice_t *voice = &voices[v];
+            if (voice->on) {
+                voice->level = MIN(voice->level + attack_step, LEVEL_MAX);
+            } else if (voice->level > release_step) {
+                voice->level -= release_step;
+            } else {
+                voice->level = 0;
+                continue;
+            }
+
+            int32_t sample = (int32_t)wavetable[voice->phase >> shift] - center;
+            mix += sample * (int32_t)voice->level;
+            total += voice->level;
+            voice->phase += voice->increment;
+        }
+
+        // Normalizing by the sum of the envelopes rather than the number of tones keeps overlapping
+        // fade ins and outs from clipping, and chords from getting louder as they are released
+        int32_t value = (int32_t)mixer_config->off_value + mix / MAX(total, (int32_t)LEVEL_MAX);
+        samples[s]    = (uint16_t)(value < 0 ? 0 : MIN(value, (int32_t)mixer_config->sample_max));
+    }
+}
+
+bool audio_mixer_is_silent(void) {
+    for (uint8_t v = 0; v < AUDIO_MIXER_VOICES; v++) {
+        if (voices[v].on || voices[v].level > 0) {
+            return false;
+        }
+    }
+    return true;
+}
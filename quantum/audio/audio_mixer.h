@@ -0,0 +1,73 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "audio.h"
+
+#ifndef AUDIO_MIXER_VOICES
+#    ifdef AUDIO_MAX_SIMULTANEOUS_TONES
+#        define AUDIO_MIXER_VOICES AUDIO_MAX_SIMULTANEOUS_TONES
+#    else
+#        define AUDIO_MIXER_VOICES 4
+#    endif
+#endif
+
+#ifndef AUDIO_MIXER_ATTACK_MS
+#    define AUDIO_MIXER_ATTACK_MS 2
+#endif
+
+#ifndef AUDIO_MIXER_RELEASE_MS
+#    define AUDIO_MIXER_RELEASE_MS 8
+#endif
+
+/**
+ * @struct Output format and waveform of the mixer.
+ */
+typedef struct {
+    uint32_t        sample_rate;      // effective output sample rate, in Hz
+    const uint16_t *wavetable;        // one period of the waveform, as unsigned samples
+    uint8_t         wavetable_bits;   // log2 of the wavetable length
+    uint16_t        wavetable_center; // wavetable value corresponding to silence
+    uint16_t        off_value;        // output value corresponding to silence
+    uint16_t        sample_max;       // highest output value
+} audio_mixer_config_t;
+
+/**
+ * Resets all voices and selects the output format. Must be called before anything else.
+ *
+ * @param config[in] the output format, which must stay valid while the mixer is in use
+ */
+void audio_mixer_init(const audio_mixer_config_t *config);
+
+/**
+ * Selects the tones to play. Tones that keep playing carry on seamlessly, new ones fade in and
+ * those no longer requested fade out, each with their own envelope.
+ *
+ * Float conversions happen here, so this should be called from a task rather than an ISR.
+ *
+ * @param frequencies[in] the frequencies of the tones, in Hz
+ * @param count[in] the number of tones, only the first AUDIO_MIXER_VOICES are played
+ */
+void audio_mixer_set_tones(const float *frequencies, uint8_t count);
+
+/**
+ * Updates the audio state and hands the currently playing tones over to the mixer.
+ */
+void audio_mixer_update(void);
+
+/**
+ * Renders the next block of samples, using integer maths only.
+ *
+ * @param samples[out] the buffer to fill
+ * @param count[in] the number of samples to render
+ */
+void audio_mixer_render(uint16_t *samples, size_t count);
+
+/**
+ * @return true if all voices have faded out, so further blocks would only contain the off value
+ */
+bool audio_mixer_is_silent(void);
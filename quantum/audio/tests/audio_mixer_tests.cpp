@@ -0,0 +1,246 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+// audio.h relies on C11's spelling
+#define _Static_assert static_assert
+
+extern "C" {
+#include "audio_mixer.h"
+#include "timer.h"
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+constexpr uint32_t SAMPLE_RATE = 16000;
+constexpr size_t   BLOCK_SIZE  = SAMPLE_RATE / 1000; // one block per millisecond
+constexpr uint16_t SAMPLE_MAX  = 4095;
+constexpr uint16_t OFF_VALUE   = 2048;
+constexpr size_t   MAX_SAMPLES = SAMPLE_RATE * 10;
+
+uint16_t             wavetable[256];
+audio_mixer_config_t mixer_config;
+
+float startup_song[][2]    = SONG(STARTUP_SOUND);
+float goodbye_song[][2]    = SONG(GOODBYE_SOUND);
+float ode_to_joy_song[][2] = SONG(ODE_TO_JOY);
+
+// Built with integer maths only, so that the rendered output doesn't depend on the host's libm
+void init_wavetable(void) {
+    for (int i = 0; i < 256; i++) {
+        int triangle = i < 64 ? i : i < 192 ? 128 - i : i - 256;
+        wavetable[i] = OFF_VALUE + triangle * 2047 / 64;
+    }
+}
+
+std::vector<uint16_t> render_ms(uint32_t duration_ms) {
+    std::vector<uint16_t> samples(duration_ms * BLOCK_SIZE);
+    for (uint32_t ms = 0; ms < duration_ms; ms++) {
+        audio_mixer_render(&samples[ms * BLOCK_SIZE], BLOCK_SIZE);
+    }
+    return samples;
+}
+
+// Steps the audio state and the mixer together, like the driver's render task, until everything has been played
+std::vector<uint16_t> render_until_silent(void) {
+    std::vector<uint16_t> samples;
+    do {
+        audio_mixer_update();
+        samples.resize(samples.size() + BLOCK_SIZE);
+        audio_mixer_render(&samples[samples.size() - BLOCK_SIZE], BLOCK_SIZE);
+        advance_time(1);
+    } while ((audio_is_playing_melody() || audio_is_playing_note() || !audio_mixer_is_silent()) && samples.size() < MAX_SAMPLES);
+    return samples;
+}
+
+// Mono 16-bit PCM, centered on the off value
+std::vector<uint8_t> to_wav(const std::vector<uint16_t> &samples) {
+    std::vector<uint8_t> wav;
+    auto                 put16 = [&](uint16_t v) {
+        wav.push_back(v & 0xFF);
+        wav.push_back(v >> 8);
+    };
+    auto put32 = [&](uint32_t v) {
+        put16(v & 0xFFFF);
+        put16(v >> 16);
+    };
+    auto put_tag = [&](const char *tag) { wav.insert(wav.end(), tag, tag + 4); };
+
+    uint32_t data_size = samples.size() * 2;
+    put_tag("RIFF");
+    put32(36 + data_size);
+    put_tag("WAVE");
+    put_tag("fmt ");
+    put32(16);
+    put16(1); // PCM
+    put16(1); // mono
+    put32(SAMPLE_RATE);
+    put32(SAMPLE_RATE * 2);
+    put16(2);
+    put16(16);
+    put_tag("data");
+    put32(data_size);
+    for (uint16_t sample : samples) {
+        put16((uint16_t)(int16_t)((sample - OFF_VALUE) * 16));
+    }
+    return wav;
+}
+
+uint32_t fnv1a(const std::vector<uint8_t> &data) {
+    uint32_t hash = 2166136261u;
+    for (uint8_t byte : data) {
+        hash = (hash ^ byte) * 16777619u;
+    }
+    return hash;
+}
+
+// Set AUDIO_MIXER_WAV_DIR to listen to what the golden hashes correspond to
+uint32_t hash_wav(const std::vector<uint16_t> &samples, const char *name) {
+    std::vector<uint8_t> wav = to_wav(samples);
+    const char          *dir = getenv("AUDIO_MIXER_WAV_DIR");
+    if (dir) {
+        std::string path = std::string(dir) + "/" + name + ".wav";
+        FILE       *file = fopen(path.c_str(), "wb");
+        if (file) {
+            fwrite(wav.data(), 1, wav.size(), file);
+            fclose(file);
+        }
+    }
+    return fnv1a(wav);
+}
+
+size_t count_rising_crossings(const std::vector<uint16_t> &samples) {
+    size_t crossings = 0;
+    for (size_t i = 1; i < samples.size(); i++) {
+        if (samples[i - 1] < OFF_VALUE && samples[i] >= OFF_VALUE) {
+            crossings++;
+        }
+    }
+    return crossings;
+}
+
+} // namespace
+
+class AudioMixerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        init_wavetable();
+        mixer_config = {
+            .sample_rate      = SAMPLE_RATE,
+            .wavetable        = wavetable,
+            .wavetable_bits   = 8,
+            .wavetable_center = OFF_VALUE,
+            .off_value        = OFF_VALUE,
+            .sample_max       = SAMPLE_MAX,
+        };
+        set_time(0);
+        audio_init();
+        audio_stop_all();
+        audio_mixer_init(&mixer_config);
+    }
+};
+
+TEST_F(AudioMixerTest, SilentUntilTonesAreSet) {
+    EXPECT_TRUE(audio_mixer_is_silent());
+    for (uint16_t sample : render_ms(10)) {
+        ASSERT_EQ(sample, OFF_VALUE);
+    }
+}
+
+TEST_F(AudioMixerTest, EnvelopeFadesInAndOut) {
+    float tone = 440.0f;
+    audio_mixer_set_tones(&tone, 1);
+    EXPECT_FALSE(audio_mixer_is_silent());
+
+    std::vector<uint16_t> attack = render_ms(AUDIO_MIXER_ATTACK_MS);
+    EXPECT_EQ(attack[0], OFF_VALUE);
+    // The first samples are scaled down by the attack
+    EXPECT_LT(abs(attack[8] - OFF_VALUE), abs((int)wavetable[8 * 440 * 256 / SAMPLE_RATE] - OFF_VALUE));
+
+    audio_mixer_set_tones(NULL, 0);
+    render_ms(AUDIO_MIXER_RELEASE_MS + 1);
+    EXPECT_TRUE(audio_mixer_is_silent());
+    for (uint16_t sample : render_ms(10)) {
+        ASSERT_EQ(sample, OFF_VALUE);
+    }
+}
+
+TEST_F(AudioMixerTest, FrequencyIsAccurate) {
+    float tone = 440.0f;
+    audio_mixer_set_tones(&tone, 1);
+    EXPECT_NEAR(count_rising_crossings(render_ms(1000)), 440, 1);
+
+    tone = 1318.51f;
+    audio_mixer_set_tones(&tone, 1);
+    EXPECT_NEAR(count_rising_crossings(render_ms(1000)), 1319, 1);
+}
+
+TEST_F(AudioMixerTest, ChordsDoNotClip) {
+    float tones[] = {440.0f, 554.37f, 659.25f};
+    audio_mixer_set_tones(tones, 3);
+    for (uint16_t sample : render_ms(500)) {
+        ASSERT_GT(sample, 0);
+        ASSERT_LT(sample, SAMPLE_MAX);
+    }
+
+    // Releasing the chord keeps the scale, so the tail can't get any louder
+    uint16_t peak = 0;
+    for (uint16_t sample : render_ms(100)) {
+        peak = std::max<uint16_t>(peak, sample);
+    }
+    audio_mixer_set_tones(NULL, 0);
+    for (uint16_t sample : render_ms(AUDIO_MIXER_RELEASE_MS)) {
+        ASSERT_LE(sample, peak);
+    }
+}
+
+TEST_F(AudioMixerTest, ExtraTonesAreDropped) {
+    float tones[AUDIO_MIXER_VOICES + 2];
+    for (int i = 0; i < AUDIO_MIXER_VOICES + 2; i++) {
+        tones[i] = 220.0f * (i + 1);
+    }
+    audio_mixer_set_tones(tones, AUDIO_MIXER_VOICES + 2);
+    std::vector<uint16_t> capped = render_ms(100);
+
+    audio_mixer_init(&mixer_config);
+    audio_mixer_set_tones(tones, AUDIO_MIXER_VOICES);
+    EXPECT_EQ(capped, render_ms(100));
+}
+
+TEST_F(AudioMixerTest, RenderStartupSong) {
+    PLAY_SONG(startup_song);
+    std::vector<uint16_t> samples = render_until_silent();
+    ASSERT_LT(samples.size(), MAX_SAMPLES);
+    EXPECT_EQ(hash_wav(samples, "startup_sound"), 3666352554u);
+}
+
+TEST_F(AudioMixerTest, RenderGoodbyeSong) {
+    PLAY_SONG(goodbye_song);
+    std::vector<uint16_t> samples = render_until_silent();
+    ASSERT_LT(samples.size(), MAX_SAMPLES);
+    EXPECT_EQ(hash_wav(samples, "goodbye_sound"), 1840745662u);
+}
+
+TEST_F(AudioMixerTest, RenderOdeToJoy) {
+    PLAY_SONG(ode_to_joy_song);
+    std::vector<uint16_t> samples = render_until_silent();
+    ASSERT_LT(samples.size(), MAX_SAMPLES);
+    EXPECT_EQ(hash_wav(samples, "ode_to_joy"), 440982489u);
+}
+
+TEST_F(AudioMixerTest, RenderChord) {
+    audio_play_note(440.0f, 200);
+    audio_play_note(554.37f, 150);
+    audio_play_note(659.25f, 100);
+    std::vector<uint16_t> samples = render_until_silent();
+    ASSERT_LT(samples.size(), MAX_SAMPLES);
+    EXPECT_EQ(hash_wav(samples, "chord"), 1354856891u);
+}
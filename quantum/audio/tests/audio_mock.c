@@ -0,0 +1,21 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "audio.h"
+#include "eeconfig.h"
+
+// enabled and valid, see audio_config_t
+static uint8_t audio_eeconfig = 0b101;
+
+uint8_t eeconfig_read_audio(void) {
+    return audio_eeconfig;
+}
+
+void eeconfig_update_audio(uint8_t val) {
+    audio_eeconfig = val;
+}
+
+// The tests drive the mixer themselves, as a driver's render task would
+void audio_driver_initialize_impl(void) {}
+void audio_driver_start_impl(void) {}
+void audio_driver_stop_impl(void) {}
@@ -0,0 +1,16 @@
+# The letter case of these variables might seem odd. However:
+# - it is consistent with the example that is used as a reference in the Unit Testing article (https://docs.qmk.fm/#/unit_testing?id=adding-tests-for-new-or-existing-features)
+# - Neither `make test:audio_mixer` or `make test:AUDIO_MIXER` work when using SCREAMING_SNAKE_CASE
+
+audio_mixer_DEFS := -DNO_DEBUG -DNO_PRINT -DAUDIO_ENABLE -DAUDIO_MIXER_VOICES=4 -DEEPROM_TEST_HARNESS
+audio_mixer_INC := $(QUANTUM_PATH)/audio
+
+audio_mixer_SRC := \
+	$(QUANTUM_PATH)/audio/tests/audio_mock.c \
+	$(QUANTUM_PATH)/audio/tests/audio_mixer_tests.cpp \
+	$(QUANTUM_PATH)/audio/audio_mixer.c \
+	$(QUANTUM_PATH)/audio/audio.c \
+	$(QUANTUM_PATH)/audio/voices.c \
+	$(QUANTUM_PATH)/audio/luts.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
@@ -15,6 +15,7 @@
 #include <stdint.h>
 #include "caps_word.h"
 #include "timer.h"
+#include "timer_wheel.h"
 #include "action.h"
 #include "action_util.h"
 
@@ -31,6 +32,9 @@ static bool caps_word_active = false;
 /** @brief Deadline for idle timeout. */
 static uint16_t idle_timer = 0;
 
+/** @brief Wakes up caps_word_task() once the idle timeout is due. */
+static timer_wheel_timer_t idle_timeout = TIMER_WHEEL_TIMER(caps_word_task);
+
 void caps_word_task(void) {
     if (caps_word_active && timer_expired(timer_read(), idle_timer)) {
         caps_word_off();
@@ -39,6 +43,7 @@ void caps_word_task(void) {
 
 void caps_word_reset_idle_timer(void) {
     idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
+    timer_wheel_schedule(&idle_timeout, CAPS_WORD_IDLE_TIMEOUT);
 }
 #else
 void caps_word_task(void) {}
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <stddef.h>
+#include <stdint.h>
 #include <timer.h>
 #include <deferred_exec.h>
 
@@ -12,30 +13,125 @@
 //------------------------------------
 // Helpers
 //
+// Each table is kept as an indexed binary min-heap ordered by trigger time, threaded through the executors themselves
+// so that custom-allocated tables need no extra storage:
+//   - table[pos].heap_slot holds 1 + the slot of the executor at heap position `pos`. Positions below the number of
+//     queued executors form the heap, the remaining positions list the free slots. Zero means the table has not been
+//     set up yet.
+//   - table[slot].heap_pos holds the heap position of the executor in `slot`.
+//   - table[slot].ran_this_pass marks repeating executors which are still due after running during the current pass of
+//     deferred_exec_advanced_task(). They sort after all other executors until the pass ends.
+// Tokens are allocated such that `token % table_count` is the slot holding them, so lookups don't need to search.
+
+#define MAX_TABLE_COUNT 255
 
 static deferred_token current_token = 0;
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+static inline size_t usable_count(size_t table_count) {
+    return table_count > MAX_TABLE_COUNT ? MAX_TABLE_COUNT : table_count;
+}
+
+static inline uint8_t heap_slot(deferred_executor_t *table, size_t pos) {
+    return table[pos].heap_slot - 1;
+}
+
+static inline void heap_set(deferred_executor_t *table, size_t pos, uint8_t slot) {
+    table[pos].heap_slot = slot + 1;
+    table[slot].heap_pos = pos;
+}
+
+static inline void heap_prepare(deferred_executor_t *table, size_t table_count) {
+    if (table[0].heap_slot == 0) {
+        for (size_t i = 0; i < table_count; ++i) {
+            heap_set(table, i, i);
+        }
+    }
+}
+
+static inline bool heap_before(deferred_executor_t *table, size_t a, size_t b) {
+    deferred_executor_t *entry_a = &table[heap_slot(table, a)];
+    deferred_executor_t *entry_b = &table[heap_slot(table, b)];
+    if (entry_a->ran_this_pass != entry_b->ran_this_pass) {
+        return entry_b->ran_this_pass;
     }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+    return ((int32_t)TIMER_DIFF_32(entry_a->trigger_time, entry_b->trigger_time)) < 0;
+}
+
+static inline void heap_swap(deferred_executor_t *table, size_t a, size_t b) {
+    uint8_t slot_a = heap_slot(table, a);
+    heap_set(table, a, heap_slot(table, b));
+    heap_set(table, b, slot_a);
+}
+
+static void heap_fix(deferred_executor_t *table, size_t active, size_t pos) {
+    // Sift up towards the root...
+    while (pos > 0 && heap_before(table, pos, (pos - 1) / 2)) {
+        heap_swap(table, pos, (pos - 1) / 2);
+        pos = (pos - 1) / 2;
+    }
+    // ...and then down towards the leaves, only one of which will actually move anything
+    while (2 * pos + 1 < active) {
+        size_t child = 2 * pos + 1;
+        if (child + 1 < active && heap_before(table, child + 1, child)) {
+            ++child;
+        }
+        if (!heap_before(table, child, pos)) {
+            break;
         }
+        heap_swap(table, pos, child);
+        pos = child;
     }
-    return true;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+static size_t heap_active(deferred_executor_t *table, size_t table_count) {
+    // Queued executors occupy a prefix of the heap positions, so the boundary can be found by bisection
+    size_t lo = 0;
+    size_t hi = table_count;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (table[heap_slot(table, mid)].token != INVALID_DEFERRED_TOKEN) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
+    return lo;
+}
+
+static void heap_remove(deferred_executor_t *table, size_t active, uint8_t slot) {
+    deferred_executor_t *entry = &table[slot];
+    size_t               pos   = entry->heap_pos;
+
+    entry->token         = INVALID_DEFERRED_TOKEN;
+    entry->ran_this_pass = false;
+    entry->trigger_time  = 0;
+    entry->callback      = NULL;
+    entry->cb_arg        = NULL;
+
+    // Move the freed slot just past the end of the heap, and restore the ordering of whatever took its place
+    if (pos != active - 1) {
+        heap_swap(table, pos, active - 1);
+        heap_fix(table, active - 1, pos);
+    }
+}
+
+static inline deferred_executor_t *find_executor(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return NULL;
+    }
+    deferred_executor_t *entry = &table[token % table_count];
+    return entry->token == token ? entry : NULL;
+}
+
+static inline deferred_token allocate_token(size_t table_count, uint8_t slot) {
+    // Next token after the most recently issued one that maps onto the slot -- as each slot holds a single executor,
+    // any token mapping onto a free slot cannot be in use.
+    uint16_t token = current_token + 1;
+    token += (slot + table_count - (token % table_count)) % table_count;
+    if (token > UINT8_MAX) {
+        token = slot == 0 ? table_count : slot;
+    }
+    current_token = token;
     return current_token;
 }
 
@@ -48,28 +144,25 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
     if (!table || table_count == 0 || delay_ms == 0 || !callback) {
         return INVALID_DEFERRED_TOKEN;
     }
+    table_count = usable_count(table_count);
+    heap_prepare(table, table_count);
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
-
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Claim the first free slot
+    size_t active = heap_active(table, table_count);
+    if (active == table_count) {
+        // None available
+        return INVALID_DEFERRED_TOKEN;
     }
+    uint8_t              slot  = heap_slot(table, active);
+    deferred_executor_t *entry = &table[slot];
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry, and queue it in order of its trigger time
+    entry->token        = allocate_token(table_count, slot);
+    entry->trigger_time = timer_read32() + delay_ms;
+    entry->callback     = callback;
+    entry->cb_arg       = cb_arg;
+    heap_fix(table, active + 1, active);
+    return entry->token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -77,19 +170,20 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     if (!table || table_count == 0 || delay_ms == 0 || token == INVALID_DEFERRED_TOKEN) {
         return false;
     }
+    table_count = usable_count(table_count);
+    heap_prepare(table, table_count);
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    deferred_executor_t *entry = find_executor(table, table_count, token);
+    if (!entry) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    entry->trigger_time = timer_read32() + delay_ms;
+    heap_fix(table, heap_active(table, table_count), entry->heap_pos);
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -97,22 +191,19 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     if (!table || table_count == 0 || token == INVALID_DEFERRED_TOKEN) {
         return false;
     }
+    table_count = usable_count(table_count);
+    heap_prepare(table, table_count);
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    deferred_executor_t *entry = find_executor(table, table_count, token);
+    if (!entry) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    heap_remove(table, heap_active(table, table_count), entry - table);
+    return true;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -122,34 +213,60 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        if (!table || table_count == 0) {
+            return;
+        }
+        table_count = usable_count(table_count);
+        heap_prepare(table, table_count);
+
+        // Only the executor at the root of the heap needs checking -- keep going while it is due, and hasn't run yet
+        size_t active;
+        size_t still_due = 0;
+        while ((active = heap_active(table, table_count)) > 0) {
+            uint8_t              slot       = heap_slot(table, 0);
+            deferred_executor_t *entry      = &table[slot];
             deferred_token       curr_token = entry->token;
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+            if (entry->ran_this_pass || ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+                break;
+            }
+
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+            // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
+            if (entry->token != curr_token) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                entry->trigger_time += delay_ms;
 
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
+                // An executor that is still behind gets its next turn on the following pass, and in the meantime
+                // mustn't keep the other due executors from running
+                if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
+                    entry->ran_this_pass = true;
+                    ++still_due;
                 }
+                heap_fix(table, heap_active(table, table_count), entry->heap_pos);
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                heap_remove(table, heap_active(table, table_count), slot);
+            }
+        }
 
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
+        // Sort the executors which are still behind back in by trigger time, one at a time so the heap stays valid
+        if (still_due > 0) {
+            active = heap_active(table, table_count);
+            for (size_t slot = 0; slot < table_count; ++slot) {
+                if (table[slot].ran_this_pass) {
+                    table[slot].ran_this_pass = false;
+                    heap_fix(table, active, table[slot].heap_pos);
                 }
             }
         }
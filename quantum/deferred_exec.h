@@ -73,9 +73,13 @@ void deferred_exec_task(void);
  * @struct Structure for containing self-hosted deferred executor tables.
  * @brief Core-side code can use this to create their own tables without impacting on the use of users' ability to add deferred execution.
  *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array.
+ *        Tables must be zero-initialised before first use, and at most 255 entries of a table are used.
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
+    uint8_t                heap_pos;
+    uint8_t                heap_slot;
+    bool                   ran_this_pass;
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
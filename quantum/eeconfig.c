@@ -48,6 +48,8 @@ void eeconfig_init_quantum(void) {
     eeprom_driver_format(false);
 #endif
 
+    eeconfig_transaction_begin();
+
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
     eeprom_update_byte(EECONFIG_DEBUG, 0);
     default_layer_state = (layer_state_t)1 << 0;
@@ -83,6 +85,8 @@ void eeconfig_init_quantum(void) {
 #endif
 
     eeconfig_init_kb();
+
+    eeconfig_transaction_commit();
 }
 
 /** \brief eeconfig initialization
@@ -112,6 +116,28 @@ void eeconfig_disable(void) {
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
 }
 
+/** \brief eeconfig transaction begin
+ *
+ * Stages subsequent EEPROM writes until the matching eeconfig_transaction_commit(), allowing drivers to coalesce them
+ * into as few underlying writes as possible. Transactions may be nested.
+ */
+void eeconfig_transaction_begin(void) {
+#if defined(EEPROM_DRIVER)
+    eeprom_driver_transaction_begin();
+#endif
+}
+
+/** \brief eeconfig transaction commit
+ *
+ * Writes all data staged since the matching eeconfig_transaction_begin(). Where supported by the driver, the staged
+ * data is committed atomically.
+ */
+void eeconfig_transaction_commit(void) {
+#if defined(EEPROM_DRIVER)
+    eeprom_driver_transaction_commit();
+#endif
+}
+
 /** \brief eeconfig is enabled
  *
  * FIXME: needs doc
@@ -304,8 +330,10 @@ void eeconfig_read_kb_datablock(void *data) {
  * FIXME: needs doc
  */
 void eeconfig_update_kb_datablock(const void *data) {
+    eeconfig_transaction_begin();
     eeprom_update_dword(EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
     eeprom_update_block(data, EECONFIG_KB_DATABLOCK, (EECONFIG_KB_DATA_SIZE));
+    eeconfig_transaction_commit();
 }
 /** \brief eeconfig init keyboard data block
  *
@@ -341,8 +369,10 @@ void eeconfig_read_user_datablock(void *data) {
  * FIXME: needs doc
  */
 void eeconfig_update_user_datablock(const void *data) {
+    eeconfig_transaction_begin();
     eeprom_update_dword(EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
     eeprom_update_block(data, EECONFIG_USER_DATABLOCK, (EECONFIG_USER_DATA_SIZE));
+    eeconfig_transaction_commit();
 }
 /** \brief eeconfig init user data block
  *
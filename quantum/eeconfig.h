@@ -120,6 +120,9 @@ void eeconfig_enable(void);
 
 void eeconfig_disable(void);
 
+void eeconfig_transaction_begin(void);
+void eeconfig_transaction_commit(void);
+
 uint8_t eeconfig_read_debug(void);
 void    eeconfig_update_debug(uint8_t val);
 
@@ -14,6 +14,8 @@ __attribute__((weak)) bool should_process_encoder(void) {
     return is_keyboard_master();
 }
 
+RING_BUFFER_IMPLEMENT(encoder_event_ring, encoder_events_t, encoder_event_t, MAX_QUEUED_ENCODER_EVENTS, queue);
+
 static encoder_events_t encoder_events;
 static bool             signal_queue_drain = false;
 
@@ -23,7 +25,7 @@ void encoder_init(void) {
 }
 
 static void encoder_queue_drain(void) {
-    encoder_events.tail     = encoder_events.head;
+    encoder_event_ring_drain(&encoder_events);
     encoder_events.dequeued = encoder_events.enqueued;
 }
 
@@ -83,7 +85,7 @@ bool encoder_task(void) {
 }
 
 bool encoder_queue_full_advanced(encoder_events_t *events) {
-    return events->tail == (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    return encoder_event_ring_full(events);
 }
 
 bool encoder_queue_full(void) {
@@ -91,7 +93,7 @@ bool encoder_queue_full(void) {
 }
 
 bool encoder_queue_empty_advanced(encoder_events_t *events) {
-    return events->head == events->tail;
+    return encoder_event_ring_empty(events);
 }
 
 bool encoder_queue_empty(void) {
@@ -99,34 +101,25 @@ bool encoder_queue_empty(void) {
 }
 
 bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise) {
-    // Drop out if we're full
-    if (encoder_queue_full_advanced(events)) {
+    // Append the event, dropping out if we're full
+    encoder_event_t new_event = {.index = index, .clockwise = clockwise ? 1 : 0};
+    if (!encoder_event_ring_push(events, new_event)) {
         return false;
     }
 
-    // Append the event
-    encoder_event_t new_event   = {.index = index, .clockwise = clockwise ? 1 : 0};
-    events->queue[events->head] = new_event;
-
-    // Increment the head index
-    events->head = (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
     events->enqueued++;
-
     return true;
 }
 
 bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise) {
-    if (encoder_queue_empty_advanced(events)) {
+    // Retrieve the event
+    encoder_event_t event;
+    if (!encoder_event_ring_pop(events, &event)) {
         return false;
     }
 
-    // Retrieve the event
-    encoder_event_t event = events->queue[events->tail];
-    *index                = event.index;
-    *clockwise            = event.clockwise;
-
-    // Increment the tail index
-    events->tail = (events->tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    *index     = event.index;
+    *clockwise = event.clockwise;
     events->dequeued++;
 
     return true;
@@ -21,6 +21,7 @@
 #include <stdbool.h>
 #include "gpio.h"
 #include "util.h"
+#include "ring_buffer.h"
 
 // ======== DEPRECATED DEFINES - DO NOT USE ========
 #ifdef ENCODERS_PAD_A
@@ -82,8 +83,9 @@ bool encoder_update_user(uint8_t index, bool clockwise);
 
 #    define NUM_ENCODERS_MAX_PER_SIDE MAX(NUM_ENCODERS_LEFT, NUM_ENCODERS_RIGHT)
 
+// The queue is a ring buffer, so its size must be a power of two
 #    ifndef MAX_QUEUED_ENCODER_EVENTS
-#        define MAX_QUEUED_ENCODER_EVENTS MAX(4, ((NUM_ENCODERS_MAX_PER_SIDE) + 1))
+#        define MAX_QUEUED_ENCODER_EVENTS RING_BUFFER_SIZE_FOR(MAX(4, ((NUM_ENCODERS_MAX_PER_SIDE) + 1)))
 #    endif // MAX_QUEUED_ENCODER_EVENTS
 
 typedef struct encoder_event_t {
@@ -23,6 +23,8 @@
 extern "C" {
 #include "encoder.h"
 #include "encoder/tests/mock.h"
+
+void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t pin_b_state);
 }
 
 struct update {
@@ -142,3 +144,53 @@ TEST_F(EncoderTest, TestHalfway) {
     EXPECT_EQ(updates[0].index, 0);
     EXPECT_EQ(updates[0].clockwise, true);
 }
+
+// Feeds pin transitions straight into the decoder, as a pin change interrupt would, without running the encoder task
+void interruptDetents(int count, bool clockwise) {
+    for (int i = 0; i < count; i++) {
+        if (clockwise) {
+            encoder_quadrature_handle_read(0, 0, 1);
+            encoder_quadrature_handle_read(0, 0, 0);
+            encoder_quadrature_handle_read(0, 1, 0);
+        } else {
+            encoder_quadrature_handle_read(0, 1, 0);
+            encoder_quadrature_handle_read(0, 0, 0);
+            encoder_quadrature_handle_read(0, 0, 1);
+        }
+        encoder_quadrature_handle_read(0, 1, 1);
+    }
+}
+
+TEST_F(EncoderTest, TestInterruptBurstIsNotDropped) {
+    updates_array_idx = 0;
+    encoder_init();
+    // far more detents than the event queue can hold between two tasks
+    interruptDetents(5 * MAX_QUEUED_ENCODER_EVENTS, true);
+    EXPECT_EQ(updates_array_idx, 0);
+
+    int tasks = 0;
+    while (encoder_task()) {
+        tasks++;
+    }
+    EXPECT_GT(tasks, 1);
+    EXPECT_EQ(updates_array_idx, 5 * MAX_QUEUED_ENCODER_EVENTS);
+    for (int i = 0; i < updates_array_idx; i++) {
+        EXPECT_EQ(updates[i].index, 0);
+        EXPECT_EQ(updates[i].clockwise, true);
+    }
+}
+
+TEST_F(EncoderTest, TestInterruptBurstNetsDirections) {
+    updates_array_idx = 0;
+    encoder_init();
+    interruptDetents(7, false);
+    interruptDetents(3, true);
+
+    while (encoder_task()) {
+    }
+    EXPECT_EQ(updates_array_idx, 4);
+    for (int i = 0; i < updates_array_idx; i++) {
+        EXPECT_EQ(updates[i].index, 0);
+        EXPECT_EQ(updates[i].clockwise, false);
+    }
+}
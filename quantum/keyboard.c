@@ -25,6 +25,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keycode.h"
 #include "timer.h"
 #include "sync_timer.h"
+#include "timer_wheel.h"
 #include "print.h"
 #include "debug.h"
 #include "command.h"
@@ -667,18 +668,10 @@ void quantum_task(void) {
     sequencer_task();
 #endif
 
-#ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
-#endif
-
 #ifdef COMBO_ENABLE
     combo_task();
 #endif
 
-#ifdef LEADER_ENABLE
-    leader_task();
-#endif
-
 #ifdef WPM_ENABLE
     decay_wpm();
 #endif
@@ -691,17 +684,8 @@ void quantum_task(void) {
     autoshift_matrix_scan();
 #endif
 
-#ifdef CAPS_WORD_ENABLE
-    caps_word_task();
-#endif
-
-#ifdef SECURE_ENABLE
-    secure_task();
-#endif
-
-#ifdef LAYER_LOCK_ENABLE
-    layer_lock_task();
-#endif
+    // Features with timeouts (caps word, leader, secure, layer lock, tap dance) only run once one is due
+    timer_wheel_task();
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
@@ -790,6 +774,10 @@ void keyboard_task(void) {
     haptic_task();
 #endif
 
+#ifdef EEPROM_DRIVER
+    eeprom_driver_task();
+#endif
+
     led_task();
 
 #ifdef OS_DETECTION_ENABLE
@@ -135,17 +135,32 @@ __attribute__((weak)) uint16_t tap_dance_count(void) {
 
 _Static_assert(ARRAY_SIZE(tap_dance_actions) <= (QK_TAP_DANCE_MAX - QK_TAP_DANCE), "Number of tap dance actions exceeds maximum. Are you using SAFE_RANGE in tap dance enum?");
 
-tap_dance_action_t* tap_dance_get_raw(uint16_t tap_dance_idx) {
+const tap_dance_action_t* tap_dance_get_raw(uint16_t tap_dance_idx) {
     if (tap_dance_idx >= tap_dance_count_raw()) {
         return NULL;
     }
     return &tap_dance_actions[tap_dance_idx];
 }
 
-__attribute__((weak)) tap_dance_action_t* tap_dance_get(uint16_t tap_dance_idx) {
+__attribute__((weak)) const tap_dance_action_t* tap_dance_get(uint16_t tap_dance_idx) {
     return tap_dance_get_raw(tap_dance_idx);
 }
 
+_Static_assert(TAP_DANCE_MAX_SIMULTANEOUS > 0 && TAP_DANCE_MAX_SIMULTANEOUS <= UINT8_MAX, "TAP_DANCE_MAX_SIMULTANEOUS must be between 1 and 255");
+
+static tap_dance_state_t tap_dance_states[TAP_DANCE_MAX_SIMULTANEOUS];
+static uint8_t           tap_dance_slots[ARRAY_SIZE(tap_dance_actions)];
+
+tap_dance_state_t* tap_dance_states_raw(uint16_t* count) {
+    *count = ARRAY_SIZE(tap_dance_states);
+    return tap_dance_states;
+}
+
+uint8_t* tap_dance_slots_raw(uint16_t* count) {
+    *count = ARRAY_SIZE(tap_dance_slots);
+    return tap_dance_slots;
+}
+
 #endif // defined(TAP_DANCE_ENABLE)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -174,6 +189,12 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
     return key_override_get_raw(key_override_idx);
 }
 
+uint8_t* key_override_index_storage(uint16_t* capacity) {
+    static uint8_t key_override_index[ARRAY_SIZE(key_overrides)];
+    *capacity = ARRAY_SIZE(key_overrides);
+    return key_override_index;
+}
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,9 +73,11 @@ combo_t* combo_get(uint16_t combo_idx);
 
 #if defined(TAP_DANCE_ENABLE)
 
-// Forward declaration of tap_dance_action_t so we don't need to deal with header reordering
+// Forward declaration of tap_dance_action_t and tap_dance_state_t so we don't need to deal with header reordering
 struct tap_dance_action_t;
 typedef struct tap_dance_action_t tap_dance_action_t;
+struct tap_dance_state_t;
+typedef struct tap_dance_state_t tap_dance_state_t;
 
 // Get the number of tap dances defined in the user's keymap, stored in firmware rather than any other persistent storage
 uint16_t tap_dance_count_raw(void);
@@ -83,9 +85,14 @@ uint16_t tap_dance_count_raw(void);
 uint16_t tap_dance_count(void);
 
 // Get the tap dance definitions, stored in firmware rather than any other persistent storage
-tap_dance_action_t* tap_dance_get_raw(uint16_t tap_dance_idx);
+const tap_dance_action_t* tap_dance_get_raw(uint16_t tap_dance_idx);
 // Get the tap dance definitions, potentially stored dynamically
-tap_dance_action_t* tap_dance_get(uint16_t tap_dance_idx);
+const tap_dance_action_t* tap_dance_get(uint16_t tap_dance_idx);
+
+// Get the storage for the state of the tap dances in progress or held, with room for TAP_DANCE_MAX_SIMULTANEOUS of them
+tap_dance_state_t* tap_dance_states_raw(uint16_t* count);
+// Get the map from the tap dances in the user's keymap to their position in the state storage, plus one, or 0 if idle
+uint8_t* tap_dance_slots_raw(uint16_t* count);
 
 #endif // defined(TAP_DANCE_ENABLE)
 
@@ -108,4 +115,7 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx);
 // Get the key override definitions, potentially stored dynamically
 const key_override_t* key_override_get(uint16_t key_override_idx);
 
+// Get scratch storage for indexing the key overrides by trigger keycode, with room for one entry per key override stored in firmware
+uint8_t* key_override_index_storage(uint16_t* capacity);
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
@@ -14,6 +14,7 @@
 
 #include "layer_lock.h"
 #include "quantum_keycodes.h"
+#include "timer_wheel.h"
 
 #ifndef NO_ACTION_LAYER
 // The current lock state. The kth bit is on if layer k is locked.
@@ -23,6 +24,9 @@ layer_state_t locked_layers = 0;
 #    if defined(LAYER_LOCK_IDLE_TIMEOUT) && LAYER_LOCK_IDLE_TIMEOUT > 0
 uint32_t layer_lock_timer = 0;
 
+// Wakes up layer_lock_task() once the idle timeout is due
+static timer_wheel_timer_t layer_lock_timeout = TIMER_WHEEL_TIMER(layer_lock_task);
+
 void layer_lock_timeout_task(void) {
     if (locked_layers && timer_elapsed32(layer_lock_timer) > LAYER_LOCK_IDLE_TIMEOUT) {
         layer_lock_all_off();
@@ -31,6 +35,7 @@ void layer_lock_timeout_task(void) {
 }
 void layer_lock_activity_trigger(void) {
     layer_lock_timer = timer_read32();
+    timer_wheel_schedule(&layer_lock_timeout, LAYER_LOCK_IDLE_TIMEOUT + 1);
 }
 #    else
 void layer_lock_timeout_task(void) {}
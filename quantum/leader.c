@@ -3,10 +3,17 @@
 
 #include "leader.h"
 #include "timer.h"
+#include "timer_wheel.h"
 #include "util.h"
 
 #include <string.h>
 
+#if __has_include("leader_sequences.h")
+#    include "quantum.h"
+#    include "progmem.h"
+#    include "leader_sequences.h"
+#endif
+
 #ifndef LEADER_TIMEOUT
 #    define LEADER_TIMEOUT 300
 #endif
@@ -17,6 +24,58 @@ uint16_t leader_time          = 0;
 uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
 uint8_t  leader_sequence_size = 0;
 
+#ifdef LEADER_SEQUENCES_MAX_LENGTH
+_Static_assert(LEADER_SEQUENCES_MAX_LENGTH <= ARRAY_SIZE(leader_sequence), "Leader sequences are longer than the leader_sequence buffer");
+#endif
+
+// Wakes up leader_task() once the sequence may have timed out
+static timer_wheel_timer_t leader_timeout = TIMER_WHEEL_TIMER(leader_task);
+
+#ifdef LEADER_SEQUENCES_TRIE_SIZE
+#    define LEADER_TRIE_NO_MATCH UINT16_MAX
+
+// Offset of the trie node matching the sequence so far
+static uint16_t leader_trie_node = LEADER_TRIE_NO_MATCH;
+
+/**
+ * @brief Advances through the generated trie by one keycode.
+ *
+ * @return true if the sequence can't be extended any further, so its keycode can be sent straight away
+ */
+static bool leader_trie_advance(uint16_t keycode) {
+    if (leader_trie_node == LEADER_TRIE_NO_MATCH) {
+        return false;
+    }
+
+    uint16_t children = pgm_read_word(&leader_sequences_trie[leader_trie_node]);
+    for (uint16_t i = 0; i < children; i++) {
+        uint16_t offset = leader_trie_node + 2 + i * 2;
+        if (pgm_read_word(&leader_sequences_trie[offset]) == keycode) {
+            leader_trie_node = pgm_read_word(&leader_sequences_trie[offset + 1]);
+            return pgm_read_word(&leader_sequences_trie[leader_trie_node]) == 0;
+        }
+    }
+
+    leader_trie_node = LEADER_TRIE_NO_MATCH;
+    return false;
+}
+
+/**
+ * @brief Sends the keycode of the sequence matched so far, if any, and stops matching.
+ */
+static void leader_trie_finish(void) {
+    uint16_t keycode = KC_NO;
+    if (leader_trie_node != LEADER_TRIE_NO_MATCH) {
+        keycode = pgm_read_word(&leader_sequences_trie[leader_trie_node + 1]);
+    }
+    leader_trie_node = LEADER_TRIE_NO_MATCH;
+
+    if (keycode != KC_NO) {
+        tap_code16(keycode);
+    }
+}
+#endif
+
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
@@ -31,13 +90,20 @@ void leader_start(void) {
     }
     leader_start_user();
     leading              = true;
-    leader_time          = timer_read();
     leader_sequence_size = 0;
+#ifdef LEADER_SEQUENCES_TRIE_SIZE
+    leader_trie_node = 0;
+#endif
+    leader_reset_timer();
     memset(leader_sequence, 0, sizeof(leader_sequence));
 }
 
 void leader_end(void) {
     leading = false;
+    timer_wheel_cancel(&leader_timeout);
+#ifdef LEADER_SEQUENCES_TRIE_SIZE
+    leader_trie_finish();
+#endif
     leader_end_user();
 }
 
@@ -65,7 +131,13 @@ bool leader_sequence_add(uint16_t keycode) {
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
 
-    if (leader_add_user(keycode)) {
+#ifdef LEADER_SEQUENCES_TRIE_SIZE
+    bool complete = leader_trie_advance(keycode);
+#else
+    bool complete = false;
+#endif
+
+    if (leader_add_user(keycode) || complete) {
         leader_end();
     }
     return true;
@@ -81,6 +153,7 @@ bool leader_sequence_timed_out(void) {
 
 void leader_reset_timer(void) {
     leader_time = timer_read();
+    timer_wheel_schedule(&leader_timeout, LEADER_TIMEOUT + 1);
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
@@ -0,0 +1,78 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "deferred_print.h"
+
+#include "ring_buffer.h"
+#include "atomic_util.h"
+
+#ifdef __AVR__
+#    include "avr/xprintf.h"
+#    define deferred_print_putc xputc
+#else
+#    include "printf.h"
+#    define deferred_print_putc putchar_
+#endif
+
+RING_BUFFER_DEFINE(deferred_print_ring, uint8_t, DEFERRED_PRINT_BUFFER_SIZE);
+
+static deferred_print_ring_t deferred_print_buffer;
+static uint8_t               deferred_print_dropped = 0;
+
+void deferred_print_write(const void *record, uint8_t size) {
+    // Records are only ever written whole, so the task never sees part of one. The
+    // lock keeps a print from an interrupt from landing in the middle of another.
+    ATOMIC_BLOCK_RESTORESTATE {
+        if (DEFERRED_PRINT_BUFFER_SIZE - 1 - deferred_print_ring_count(&deferred_print_buffer) < size) {
+            if (deferred_print_dropped < UINT8_MAX) {
+                deferred_print_dropped++;
+            }
+        } else {
+            deferred_print_ring_push_bulk(&deferred_print_buffer, (const uint8_t *)record, size);
+        }
+    }
+}
+
+static void deferred_print_hex(uint8_t byte) {
+    static const char digits[] = "0123456789ABCDEF";
+    deferred_print_putc(digits[byte >> 4]);
+    deferred_print_putc(digits[byte & 0xF]);
+}
+
+static void deferred_print_prefix(void) {
+    for (const char *c = DEFERRED_PRINT_RECORD_PREFIX; *c; c++) {
+        deferred_print_putc(*c);
+    }
+}
+
+void deferred_print_task(void) {
+    for (uint8_t i = 0; i < DEFERRED_PRINT_RECORDS_PER_TASK; i++) {
+        uint8_t size;
+        if (!deferred_print_ring_pop(&deferred_print_buffer, &size)) {
+            break;
+        }
+
+        deferred_print_prefix();
+        for (uint8_t byte; size > 0 && deferred_print_ring_pop(&deferred_print_buffer, &byte); size--) {
+            deferred_print_hex(byte);
+        }
+        deferred_print_putc('\n');
+    }
+
+    // Records that didn't fit are reported as a record without a format
+    uint8_t dropped = 0;
+    ATOMIC_BLOCK_RESTORESTATE {
+        if (deferred_print_ring_empty(&deferred_print_buffer)) {
+            dropped                = deferred_print_dropped;
+            deferred_print_dropped = 0;
+        }
+    }
+    if (dropped > 0) {
+        deferred_print_prefix();
+        for (uint8_t i = 0; i < sizeof(const char *); i++) {
+            deferred_print_hex(0);
+        }
+        deferred_print_hex(dropped);
+        deferred_print_putc('\n');
+    }
+}
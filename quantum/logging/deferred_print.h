@@ -0,0 +1,86 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+// Deferred printing stores each print as a binary record of the format string's
+// address and the raw arguments, instead of formatting it at the call site.
+// deferred_print_task() streams the records out later, and `qmk console-decode`
+// formats them on the host from the firmware's .elf file.
+//
+// This only works for format strings which are literals, and with at most
+// DEFERRED_PRINT_MAX_ARGS arguments. String arguments are only printed if they
+// are constants, as the host can't read the keyboard's memory. Prints may be
+// made from interrupts, as records are written with interrupts disabled.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Size of the record buffer, in bytes. Must be a power of two, no larger than 256.
+#ifndef DEFERRED_PRINT_BUFFER_SIZE
+#    define DEFERRED_PRINT_BUFFER_SIZE 256
+#endif
+
+// How many records deferred_print_task() sends per call.
+#ifndef DEFERRED_PRINT_RECORDS_PER_TASK
+#    define DEFERRED_PRINT_RECORDS_PER_TASK 4
+#endif
+
+#define DEFERRED_PRINT_MAX_ARGS 8
+
+// Records are sent as a line of this prefix followed by the record in hex, which
+// passes through any console tool unharmed.
+#define DEFERRED_PRINT_RECORD_PREFIX "~L"
+
+void deferred_print_write(const void *record, uint8_t size);
+void deferred_print_task(void);
+
+// Never called, only lets the compiler check the arguments against the format
+static inline __attribute__((format(printf, 1, 2))) void deferred_print_check_format(const char *fmt, ...) {}
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef __AVR__
+#    include <avr/pgmspace.h>
+#    define DEFERRED_PRINT_FORMAT(fmt) PSTR(fmt)
+#else
+#    define DEFERRED_PRINT_FORMAT(fmt) (fmt)
+#endif
+
+// Integer arguments are stored promoted to at least int, as printf() would
+// receive them, so that the host can tell their size from the format. Floating
+// point arguments aren't promoted, and aren't supported.
+#define DEFERRED_PRINT_FIELD(n, x) __typeof__((x) + 0) arg##n;
+
+#define DEFERRED_PRINT_RECORD(fmt, fields, ...)                                                                     \
+    do {                                                                                                            \
+        struct __attribute__((packed)) {                                                                            \
+            uint8_t     size;                                                                                       \
+            const char *format;                                                                                     \
+            fields                                                                                                  \
+        } deferred_print_record_ = {sizeof(deferred_print_record_) - 1, DEFERRED_PRINT_FORMAT(fmt), ##__VA_ARGS__}; \
+        if (0) deferred_print_check_format(fmt, ##__VA_ARGS__);                                                     \
+        deferred_print_write(&deferred_print_record_, sizeof(deferred_print_record_));                              \
+    } while (0)
+
+#define DEFERRED_PRINT_0(fmt) DEFERRED_PRINT_RECORD(fmt, )
+#define DEFERRED_PRINT_1(fmt, a) DEFERRED_PRINT_RECORD(fmt, DEFERRED_PRINT_FIELD(1, a), a)
+#define DEFERRED_PRINT_2(fmt, a, b) DEFERRED_PRINT_RECORD(fmt, DEFERRED_PRINT_FIELD(1, a) DEFERRED_PRINT_FIELD(2, b), a, b)
+#define DEFERRED_PRINT_3(fmt, a, b, c) DEFERRED_PRINT_RECORD(fmt, DEFERRED_PRINT_FIELD(1, a) DEFERRED_PRINT_FIELD(2, b) DEFERRED_PRINT_FIELD(3, c), a, b, c)
+#define DEFERRED_PRINT_4(fmt, a, b, c, d) DEFERRED_PRINT_RECORD(fmt, DEFERRED_PRINT_FIELD(1, a) DEFERRED_PRINT_FIELD(2, b) DEFERRED_PRINT_FIELD(3, c) DEFERRED_PRINT_FIELD(4, d), a, b, c, d)
+#define DEFERRED_PRINT_5(fmt, a, b, c, d, e) DEFERRED_PRINT_RECORD(fmt, DEFERRED_PRINT_FIELD(1, a) DEFERRED_PRINT_FIELD(2, b) DEFERRED_PRINT_FIELD(3, c) DEFERRED_PRINT_FIELD(4, d) DEFERRED_PRINT_FIELD(5, e), a, b, c, d, e)
+#define DEFERRED_PRINT_6(fmt, a, b, c, d, e, f) DEFERRED_PRINT_RECORD(fmt, DEFERRED_PRINT_FIELD(1, a) DEFERRED_PRINT_FIELD(2, b) DEFERRED_PRINT_FIELD(3, c) DEFERRED_PRINT_FIELD(4, d) DEFERRED_PRINT_FIELD(5, e) DEFERRED_PRINT_FIELD(6, f), a, b, c, d, e, f)
+#define DEFERRED_PRINT_7(fmt, a, b, c, d, e, f, g) DEFERRED_PRINT_RECORD(fmt, DEFERRED_PRINT_FIELD(1, a) DEFERRED_PRINT_FIELD(2, b) DEFERRED_PRINT_FIELD(3, c) DEFERRED_PRINT_FIELD(4, d) DEFERRED_PRINT_FIELD(5, e) DEFERRED_PRINT_FIELD(6, f) DEFERRED_PRINT_FIELD(7, g), a, b, c, d, e, f, g)
+#define DEFERRED_PRINT_8(fmt, a, b, c, d, e, f, g, h) DEFERRED_PRINT_RECORD(fmt, DEFERRED_PRINT_FIELD(1, a) DEFERRED_PRINT_FIELD(2, b) DEFERRED_PRINT_FIELD(3, c) DEFERRED_PRINT_FIELD(4, d) DEFERRED_PRINT_FIELD(5, e) DEFERRED_PRINT_FIELD(6, f) DEFERRED_PRINT_FIELD(7, g) DEFERRED_PRINT_FIELD(8, h), a, b, c, d, e, f, g, h)
+
+#define DEFERRED_PRINT_NARGS(...) DEFERRED_PRINT_NARGS_(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define DEFERRED_PRINT_NARGS_(fmt, _1, _2, _3, _4, _5, _6, _7, _8, n, ...) n
+#define DEFERRED_PRINT_SELECT(n) DEFERRED_PRINT_SELECT_(n)
+#define DEFERRED_PRINT_SELECT_(n) DEFERRED_PRINT_##n
+
+#define deferred_printf(...) DEFERRED_PRINT_SELECT(DEFERRED_PRINT_NARGS(__VA_ARGS__))(__VA_ARGS__)
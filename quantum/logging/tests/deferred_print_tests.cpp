@@ -0,0 +1,123 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "print.h"
+}
+
+static std::string output;
+
+static int8_t capture_sendchar(uint8_t c) {
+    output += c;
+    return 0;
+}
+
+static std::vector<std::string> sent_lines(void) {
+    std::vector<std::string> lines;
+    size_t                   start = 0;
+    for (size_t end; (end = output.find('\n', start)) != std::string::npos; start = end + 1) {
+        lines.push_back(output.substr(start, end - start));
+    }
+    return lines;
+}
+
+static std::vector<uint8_t> record_bytes(const std::string &line) {
+    std::vector<uint8_t> bytes;
+    EXPECT_EQ(line.rfind(DEFERRED_PRINT_RECORD_PREFIX, 0), 0);
+    for (size_t i = strlen(DEFERRED_PRINT_RECORD_PREFIX); i + 1 < line.size(); i += 2) {
+        bytes.push_back(std::stoul(line.substr(i, 2), nullptr, 16));
+    }
+    return bytes;
+}
+
+static const char *record_format(const std::vector<uint8_t> &bytes) {
+    const char *format;
+    memcpy(&format, bytes.data(), sizeof(format));
+    return format;
+}
+
+class DeferredPrint : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        print_set_sendchar(capture_sendchar);
+        // Flush anything left over by a previous test
+        for (int i = 0; i < DEFERRED_PRINT_BUFFER_SIZE; i++) {
+            deferred_print_task();
+        }
+        output.clear();
+    }
+};
+
+TEST_F(DeferredPrint, NothingIsSentUntilTheTaskRuns) {
+    xprintf("hello\n");
+    EXPECT_EQ(output, "");
+
+    deferred_print_task();
+    auto lines = sent_lines();
+    ASSERT_EQ(lines.size(), 1);
+
+    auto bytes = record_bytes(lines[0]);
+    ASSERT_EQ(bytes.size(), sizeof(const char *));
+    EXPECT_STREQ(record_format(bytes), "hello\n");
+}
+
+TEST_F(DeferredPrint, ArgumentsArePromoted) {
+    uint8_t  small    = 0xAB;
+    int16_t  negative = -2;
+    uint32_t large    = 0x12345678;
+    xprintf("%u %d %lX %s", small, negative, large, "text");
+    deferred_print_task();
+
+    auto lines = sent_lines();
+    ASSERT_EQ(lines.size(), 1);
+    auto bytes = record_bytes(lines[0]);
+    ASSERT_EQ(bytes.size(), sizeof(const char *) + 3 * sizeof(int) + sizeof(const char *));
+    EXPECT_STREQ(record_format(bytes), "%u %d %lX %s");
+
+    int      promoted_small, promoted_negative;
+    uint32_t stored_large;
+    size_t   offset = sizeof(const char *);
+    memcpy(&promoted_small, &bytes[offset], sizeof(int));
+    memcpy(&promoted_negative, &bytes[offset + sizeof(int)], sizeof(int));
+    memcpy(&stored_large, &bytes[offset + 2 * sizeof(int)], sizeof(uint32_t));
+    EXPECT_EQ(promoted_small, 0xAB);
+    EXPECT_EQ(promoted_negative, -2);
+    EXPECT_EQ(stored_large, 0x12345678);
+    EXPECT_STREQ(record_format(std::vector<uint8_t>(bytes.begin() + offset + 3 * sizeof(int), bytes.end())), "text");
+}
+
+TEST_F(DeferredPrint, TaskSendsALimitedNumberOfRecords) {
+    for (int i = 0; i < DEFERRED_PRINT_RECORDS_PER_TASK + 2; i++) {
+        xprintf("%d", i);
+    }
+
+    deferred_print_task();
+    EXPECT_EQ(sent_lines().size(), DEFERRED_PRINT_RECORDS_PER_TASK);
+    deferred_print_task();
+    EXPECT_EQ(sent_lines().size(), DEFERRED_PRINT_RECORDS_PER_TASK + 2);
+}
+
+TEST_F(DeferredPrint, DroppedRecordsAreReported) {
+    const size_t record_size = 1 + sizeof(const char *);
+    const size_t fits        = (DEFERRED_PRINT_BUFFER_SIZE - 1) / record_size;
+    for (size_t i = 0; i < fits + 3; i++) {
+        xprintf("full\n");
+    }
+
+    while (sent_lines().size() < fits + 1) {
+        deferred_print_task();
+    }
+    auto lines = sent_lines();
+    ASSERT_EQ(lines.size(), fits + 1);
+
+    auto dropped = record_bytes(lines.back());
+    ASSERT_EQ(dropped.size(), sizeof(const char *) + 1);
+    EXPECT_EQ(record_format(dropped), nullptr);
+    EXPECT_EQ(dropped.back(), 3);
+}
@@ -0,0 +1,5 @@
+deferred_print_DEFS := -DDEFERRED_PRINT_ENABLE -DNO_DEBUG
+
+deferred_print_SRC := \
+    $(QUANTUM_PATH)/logging/tests/deferred_print_tests.cpp \
+    $(QUANTUM_PATH)/logging/deferred_print.c
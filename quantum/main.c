@@ -55,6 +55,11 @@ int main(void) {
         raw_hid_task();
 #endif
 
+#ifdef DEFERRED_PRINT_ENABLE
+        void deferred_print_task(void);
+        deferred_print_task();
+#endif
+
 #ifdef CONSOLE_ENABLE
         void console_task(void);
         console_task();
@@ -19,6 +19,7 @@
 #include "midi.h"
 #include <string.h> //for memcpy
 #include "util.h"
+#include "sysex_tools.h"
 
 #ifndef NULL
 #    define NULL 0
@@ -183,6 +184,41 @@ void midi_send_array(MidiDevice* device, uint16_t count, uint8_t* array) {
     }
 }
 
+typedef struct {
+    MidiDevice* device;
+    uint8_t     bytes[3];
+    uint8_t     count;
+} sysex_writer_t;
+
+static void sysex_write(sysex_writer_t* writer, uint8_t byte) {
+    writer->bytes[writer->count++] = byte;
+    if (writer->count == 3) {
+        midi_send_data(writer->device, 3, writer->bytes[0], writer->bytes[1], writer->bytes[2]);
+        writer->count = 0;
+    }
+}
+
+void midi_send_sysex_encoded(MidiDevice* device, const uint8_t* header, uint8_t header_length, const uint8_t* data, uint16_t length) {
+    sysex_writer_t writer = {.device = device};
+    uint8_t        encoded[8];
+
+    sysex_write(&writer, SYSEX_BEGIN);
+    for (uint8_t i = 0; i < header_length; i++) {
+        sysex_write(&writer, header[i]);
+    }
+    for (uint16_t i = 0; i < length; i += 7) {
+        uint16_t encoded_length = sysex_encode(encoded, data + i, MIN(length - i, 7));
+        for (uint8_t j = 0; j < encoded_length; j++) {
+            sysex_write(&writer, encoded[j]);
+        }
+    }
+    sysex_write(&writer, SYSEX_END);
+
+    if (writer.count > 0) {
+        midi_send_data(device, writer.count, writer.bytes[0], writer.bytes[1], writer.bytes[2]);
+    }
+}
+
 void midi_register_cc_callback(MidiDevice* device, midi_three_byte_func_t func) {
     device->input_cc_callback = func;
 }
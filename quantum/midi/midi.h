@@ -252,6 +252,21 @@ void midi_send_data(MidiDevice* device, uint16_t count, uint8_t byte0, uint8_t b
  */
 void midi_send_array(MidiDevice* device, uint16_t count, uint8_t* array);
 
+/**
+ * @brief Send arbitrary data as a sysex message.
+ *
+ * The data is encoded with sysex_encode 7 bytes at a time as it is sent, so
+ * large messages can be streamed without an encoded copy of the whole message.
+ * Receivers can decode it as it arrives with sysex_decode_byte.
+ *
+ * @param device the device to use for sending
+ * @param header bytes sent as is after SYSEX_BEGIN, such as a manufacturer id, must not have their top bit set
+ * @param header_length the count of header bytes
+ * @param data the data to encode and send
+ * @param length the count of data bytes
+ */
+void midi_send_sysex_encoded(MidiDevice* device, const uint8_t* header, uint8_t header_length, const uint8_t* data, uint16_t length);
+
 /**@}*/
 
 /**
@@ -4,6 +4,7 @@
 #include "midi.h"
 #include "usb_descriptor.h"
 #include "process_midi.h"
+#include "util.h"
 
 #ifdef AUDIO_ENABLE
 #    include "audio.h"
@@ -25,6 +26,19 @@ MidiDevice midi_device;
 #define SYS_COMMON_2 0x20
 #define SYS_COMMON_3 0x30
 
+// Events are sent and received a whole USB buffer at a time
+#define MIDI_BATCH_SIZE (MIDI_STREAM_EPSIZE / sizeof(MIDI_EventPacket_t))
+
+static MIDI_EventPacket_t midi_tx_events[MIDI_BATCH_SIZE];
+static uint8_t            midi_tx_count = 0;
+
+void midi_flush(void) {
+    if (midi_tx_count > 0) {
+        send_midi_packets(midi_tx_events, midi_tx_count);
+        midi_tx_count = 0;
+    }
+}
+
 static void usb_send_func(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
     MIDI_EventPacket_t event;
     event.Data1 = byte0;
@@ -74,32 +88,49 @@ static void usb_send_func(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8
         }
     }
 
-    send_midi_packet(&event);
+    // queued up until the buffer is full, or midi_flush is called at the end of midi_task
+    midi_tx_events[midi_tx_count++] = event;
+    if (midi_tx_count == MIDI_BATCH_SIZE) {
+        midi_flush();
+    }
 }
 
 static void usb_get_midi(MidiDevice* device) {
-    MIDI_EventPacket_t event;
-    while (recv_midi_packet(&event)) {
-        midi_packet_length_t length = midi_packet_length(event.Data1);
-        uint8_t              input[3];
-        input[0] = event.Data1;
-        input[1] = event.Data2;
-        input[2] = event.Data3;
-        if (length == UNDEFINED) {
-            // sysex
-            if (event.Event == MIDI_EVENT(0, SYSEX_START_OR_CONT) || event.Event == MIDI_EVENT(0, SYSEX_ENDS_IN_3)) {
-                length = 3;
-            } else if (event.Event == MIDI_EVENT(0, SYSEX_ENDS_IN_2)) {
-                length = 2;
-            } else if (event.Event == MIDI_EVENT(0, SYSEX_ENDS_IN_1)) {
-                length = 1;
-            } else {
-                // XXX what to do?
+    MIDI_EventPacket_t events[MIDI_BATCH_SIZE];
+
+    while (true) {
+        // Only take as many events as the input queue has room for (at most 3 bytes each),
+        // the others are left in the USB buffers until the next call rather than dropped
+        uint8_t room  = (MIDI_INPUT_QUEUE_LENGTH - 1 - midi_input_queue_count(&device->input_queue)) / 3;
+        uint8_t count = MIN(room, MIDI_BATCH_SIZE);
+        if (count == 0) {
+            break;
+        }
+
+        uint8_t received = recv_midi_packets(events, count);
+        for (uint8_t i = 0; i < received; i++) {
+            MIDI_EventPacket_t*  event  = &events[i];
+            midi_packet_length_t length = midi_packet_length(event->Data1);
+            if (length == UNDEFINED) {
+                // sysex
+                if (event->Event == MIDI_EVENT(0, SYSEX_START_OR_CONT) || event->Event == MIDI_EVENT(0, SYSEX_ENDS_IN_3)) {
+                    length = 3;
+                } else if (event->Event == MIDI_EVENT(0, SYSEX_ENDS_IN_2)) {
+                    length = 2;
+                } else if (event->Event == MIDI_EVENT(0, SYSEX_ENDS_IN_1)) {
+                    length = 1;
+                } else {
+                    // XXX what to do?
+                }
             }
+
+            // pass the data to the device input function, Data1 to Data3 being contiguous
+            if (length != UNDEFINED) midi_device_input(device, length, &event->Data1);
         }
 
-        // pass the data to the device input function
-        if (length != UNDEFINED) midi_device_input(device, length, input);
+        if (received < count) {
+            break;
+        }
     }
 }
 
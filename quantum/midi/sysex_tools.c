@@ -95,3 +95,20 @@ uint16_t sysex_decode(uint8_t *decoded, const uint8_t *source, const uint16_t le
         return decoded_full * 7;
     }
 }
+
+void sysex_decoder_init(sysex_decoder_t *decoder) {
+    decoder->msbs     = 0;
+    decoder->position = 0;
+}
+
+bool sysex_decode_byte(sysex_decoder_t *decoder, uint8_t encoded, uint8_t *decoded) {
+    uint8_t position  = decoder->position;
+    decoder->position = (position + 1) % 8;
+
+    if (position == 0) {
+        decoder->msbs = encoded;
+        return false;
+    }
+    *decoded = (0x7F & encoded) | (0x80 & (decoder->msbs << position));
+    return true;
+}
@@ -23,6 +23,7 @@ extern "C" {
 #endif
 
 #include <inttypes.h>
+#include <stdbool.h>
 
 /**
  * @file
@@ -85,6 +86,35 @@ uint16_t sysex_encode(uint8_t *encoded, const uint8_t *source, uint16_t length);
  */
 uint16_t sysex_decode(uint8_t *decoded, const uint8_t *source, uint16_t length);
 
+/**
+ * @brief State of a streaming decode, for messages that arrive a few bytes at a time.
+ */
+typedef struct {
+    uint8_t msbs;     ///< top bits of the current group of 7 decoded bytes
+    uint8_t position; ///< position in the current group of 8 encoded bytes
+} sysex_decoder_t;
+
+/**
+ * @brief Start decoding a new message.
+ *
+ * @param decoder The decoder state to reset.
+ */
+void sysex_decoder_init(sysex_decoder_t *decoder);
+
+/**
+ * @brief Decode the next encoded byte of a message.
+ *
+ * Feeding a message through this one byte at a time yields the same data as
+ * sysex_decode, without having to buffer the whole encoded message first.
+ *
+ * @param decoder The decoder state.
+ * @param encoded The next encoded byte.
+ * @param decoded Where to store the decoded byte, if there is one.
+ *
+ * @return true if a decoded byte was stored, false if the byte only held top bits.
+ */
+bool sysex_decode_byte(sysex_decoder_t *decoder, uint8_t encoded, uint8_t *decoded);
+
 /**@}*/
 
 #ifdef __cplusplus
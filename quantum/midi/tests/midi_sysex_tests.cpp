@@ -0,0 +1,133 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "midi.h"
+#include "sysex_tools.h"
+}
+
+namespace {
+
+struct packet_t {
+    uint16_t count;
+    uint8_t  bytes[3];
+};
+
+std::vector<packet_t> sent;
+std::vector<uint8_t>  received;
+sysex_decoder_t       decoder;
+uint8_t               header_length;
+
+void capture_send(MidiDevice *device, uint16_t count, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
+    sent.push_back({count, {byte0, byte1, byte2}});
+}
+
+// Decodes the payload as it arrives, skipping the framing and header
+void decode_sysex(MidiDevice *device, uint16_t start, uint8_t length, uint8_t *data) {
+    for (uint8_t i = 0; i < length; i++) {
+        uint16_t index = start + i;
+        uint8_t  decoded;
+        if (index <= header_length || data[i] == SYSEX_END) {
+            continue;
+        }
+        if (sysex_decode_byte(&decoder, data[i], &decoded)) {
+            received.push_back(decoded);
+        }
+    }
+}
+
+std::vector<uint8_t> make_data(uint16_t length) {
+    std::vector<uint8_t> data(length);
+    for (uint16_t i = 0; i < length; i++) {
+        data[i] = i * 37 + 11;
+    }
+    return data;
+}
+
+std::vector<uint8_t> flatten(const std::vector<packet_t> &packets) {
+    std::vector<uint8_t> bytes;
+    for (const packet_t &packet : packets) {
+        bytes.insert(bytes.end(), packet.bytes, packet.bytes + packet.count);
+    }
+    return bytes;
+}
+
+} // namespace
+
+class MidiSysexTest : public ::testing::Test {
+   protected:
+    MidiDevice device;
+
+    void SetUp() override {
+        sent.clear();
+        received.clear();
+        sysex_decoder_init(&decoder);
+        midi_device_init(&device);
+        midi_device_set_send_func(&device, capture_send);
+    }
+};
+
+TEST_F(MidiSysexTest, StreamMatchesSysexEncode) {
+    const uint8_t header[] = {0x7D, 0x01};
+
+    for (uint16_t length : {0, 1, 6, 7, 8, 13, 14, 15, 100, 1000}) {
+        std::vector<uint8_t> data = make_data(length);
+        sent.clear();
+        midi_send_sysex_encoded(&device, header, sizeof(header), data.data(), data.size());
+
+        std::vector<uint8_t> expected = {SYSEX_BEGIN, header[0], header[1]};
+        std::vector<uint8_t> encoded(sysex_encoded_length(length));
+        sysex_encode(encoded.data(), data.data(), length);
+        expected.insert(expected.end(), encoded.begin(), encoded.end());
+        expected.push_back(SYSEX_END);
+        EXPECT_EQ(flatten(sent), expected) << "length " << length;
+
+        // Every packet is full, except maybe the one ending the message
+        for (size_t i = 0; i + 1 < sent.size(); i++) {
+            ASSERT_EQ(sent[i].count, 3) << "length " << length;
+        }
+        for (size_t i = 0; i < expected.size() - 1; i++) {
+            ASSERT_EQ(expected[i] & 0x80, i == 0 ? 0x80 : 0) << "length " << length;
+        }
+    }
+}
+
+TEST_F(MidiSysexTest, DecodeByteMatchesSysexDecode) {
+    for (uint16_t length : {1, 7, 8, 20, 700}) {
+        std::vector<uint8_t> data = make_data(length);
+        std::vector<uint8_t> encoded(sysex_encoded_length(length));
+        sysex_encode(encoded.data(), data.data(), length);
+
+        std::vector<uint8_t> decoded;
+        sysex_decoder_init(&decoder);
+        for (uint8_t byte : encoded) {
+            uint8_t value;
+            if (sysex_decode_byte(&decoder, byte, &value)) {
+                decoded.push_back(value);
+            }
+        }
+        EXPECT_EQ(decoded, data) << "length " << length;
+    }
+}
+
+TEST_F(MidiSysexTest, RoundTripThroughDevice) {
+    const uint8_t        header[] = {0x7D};
+    std::vector<uint8_t> data     = make_data(1000);
+    header_length                 = sizeof(header);
+    midi_send_sysex_encoded(&device, header, sizeof(header), data.data(), data.size());
+
+    MidiDevice receiver;
+    midi_device_init(&receiver);
+    midi_register_sysex_callback(&receiver, decode_sysex);
+
+    // Packets are handed over one at a time, like the USB packets they'd be sent as
+    for (packet_t &packet : sent) {
+        midi_device_input(&receiver, packet.count, packet.bytes);
+        midi_device_process(&receiver);
+    }
+    EXPECT_EQ(received, data);
+}
@@ -0,0 +1,12 @@
+# The letter case of these variables might seem odd. However:
+# - it is consistent with the example that is used as a reference in the Unit Testing article (https://docs.qmk.fm/#/unit_testing?id=adding-tests-for-new-or-existing-features)
+# - Neither `make test:midi_sysex` or `make test:MIDI_SYSEX` work when using SCREAMING_SNAKE_CASE
+
+midi_sysex_DEFS := -DNO_DEBUG
+midi_sysex_INC := $(QUANTUM_PATH)/midi
+
+midi_sysex_SRC := \
+	$(QUANTUM_PATH)/midi/tests/midi_sysex_tests.cpp \
+	$(QUANTUM_PATH)/midi/midi.c \
+	$(QUANTUM_PATH)/midi/midi_device.c \
+	$(QUANTUM_PATH)/midi/sysex_tools.c
@@ -20,6 +20,7 @@
 #include <string.h>
 #include "timer.h"
 #include "gpio.h"
+#include "synchronization_util.h"
 
 #ifdef MOUSEKEY_ENABLE
 #    include "mousekey.h"
@@ -102,6 +103,123 @@ const pointing_device_driver_t custom_pointing_device_driver = {
 
 const pointing_device_driver_t *pointing_device_driver = &POINTING_DEVICE_DRIVER(POINTING_DEVICE_DRIVER_NAME);
 
+#ifdef POINTING_DEVICE_ACCUMULATE_MOTION
+#    include "atomic_util.h"
+
+typedef struct {
+    int32_t x;
+    int32_t y;
+    int32_t h;
+    int32_t v;
+    uint8_t buttons;         // button state as last returned by the driver
+    uint8_t changed_buttons; // buttons the driver changed since the last accumulated report
+} pointing_device_accumulator_t;
+
+// Motion read from the sensor that hasn't made it into a report yet
+static volatile pointing_device_accumulator_t accumulator = {0};
+
+static inline bool pointing_device_motion_pending(void) {
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+    return !gpio_read_pin(POINTING_DEVICE_MOTION_PIN);
+#        else
+    return gpio_read_pin(POINTING_DEVICE_MOTION_PIN);
+#        endif
+#    else
+    return true;
+#    endif
+}
+
+/**
+ * @brief Reads the sensor and adds its motion to the accumulator
+ *
+ * Runs on every pointing device task, regardless of POINTING_DEVICE_TASK_THROTTLE_MS, and may additionally be called
+ * from any other context the sensor's bus can be used from (e.g. a thread woken by the motion pin), so that sensor
+ * reads aren't held up by a long main loop. Must not be called from more than one context at the same time.
+ *
+ * @return true if the sensor was read
+ */
+bool pointing_device_sample(void) {
+#    if defined(SPLIT_POINTING_ENABLE)
+    if (!(POINTING_DEVICE_THIS_SIDE)) {
+        return false;
+    }
+#    endif
+    if (!pointing_device_motion_pending()) {
+        return false;
+    }
+
+    pointing_device_lock();
+    report_mouse_t report = pointing_device_driver->get_report((report_mouse_t){.buttons = accumulator.buttons});
+    pointing_device_unlock();
+    ATOMIC_BLOCK_FORCEON {
+        accumulator.x               += report.x;
+        accumulator.y               += report.y;
+        accumulator.h               += report.h;
+        accumulator.v               += report.v;
+        accumulator.changed_buttons |= accumulator.buttons ^ report.buttons;
+        accumulator.buttons          = report.buttons;
+    }
+    return true;
+}
+
+static inline int32_t pointing_device_take_motion(volatile int32_t *pending, int32_t min, int32_t max) {
+    int32_t value = *pending < min ? min : (*pending > max ? max : *pending);
+    *pending -= value;
+    return value;
+}
+
+/**
+ * @brief Moves the accumulated motion into a mouse report
+ *
+ * Only as much motion as fits in a single report is taken, anything beyond that is left for the next one.
+ *
+ * @param[in] mouse_report report_mouse_t whose buttons are updated with any changes read from the sensor
+ * @return report_mouse_t with the accumulated motion
+ */
+report_mouse_t pointing_device_get_accumulated_report(report_mouse_t mouse_report) {
+    ATOMIC_BLOCK_FORCEON {
+        mouse_report.x              = pointing_device_take_motion(&accumulator.x, XY_REPORT_MIN, XY_REPORT_MAX);
+        mouse_report.y              = pointing_device_take_motion(&accumulator.y, XY_REPORT_MIN, XY_REPORT_MAX);
+        mouse_report.h              = pointing_device_take_motion(&accumulator.h, HV_REPORT_MIN, HV_REPORT_MAX);
+        mouse_report.v              = pointing_device_take_motion(&accumulator.v, HV_REPORT_MIN, HV_REPORT_MAX);
+        mouse_report.buttons        = (mouse_report.buttons & ~accumulator.changed_buttons) | (accumulator.buttons & accumulator.changed_buttons);
+        accumulator.changed_buttons = 0;
+    }
+    return mouse_report;
+}
+
+#    ifdef POINTING_DEVICE_MOTION_THREAD
+#        ifndef PROTOCOL_CHIBIOS
+#            error POINTING_DEVICE_MOTION_THREAD is only supported on ChibiOS.
+#        endif
+#        ifndef POINTING_DEVICE_MOTION_PIN
+#            error POINTING_DEVICE_MOTION_THREAD requires POINTING_DEVICE_MOTION_PIN.
+#        endif
+#        include <ch.h>
+#        include <hal.h>
+#        if defined(POINTING_DEVICE_DRIVER_adns9800) || defined(POINTING_DEVICE_DRIVER_cirque_pinnacle_spi) || defined(POINTING_DEVICE_DRIVER_pmw3360) || defined(POINTING_DEVICE_DRIVER_pmw3389)
+#            if !defined(SPI_USE_MUTUAL_EXCLUSION) || (SPI_USE_MUTUAL_EXCLUSION != TRUE)
+#                error POINTING_DEVICE_MOTION_THREAD requires SPI_USE_MUTUAL_EXCLUSION to be enabled in halconf.h.
+#            endif
+#        elif defined(POINTING_DEVICE_DRIVER_azoteq_iqs5xx) || defined(POINTING_DEVICE_DRIVER_cirque_pinnacle_i2c) || defined(POINTING_DEVICE_DRIVER_pimoroni_trackball)
+#            error POINTING_DEVICE_MOTION_THREAD does not support I2C sensors, as the I2C driver does not lock the bus.
+#        endif
+
+// Use thread + palWaitLineTimeout instead of palSetLineCallback, as the sensor's bus can't be used from an ISR.
+// The timeout catches any edge missed while reading, and paces reads if the pin stays active.
+static THD_WORKING_AREA(waPointingDeviceMotionThread, 256);
+static THD_FUNCTION(PointingDeviceMotionThread, arg) {
+    (void)arg;
+    chRegSetThreadName("pointing");
+    while (true) {
+        palWaitLineTimeout(POINTING_DEVICE_MOTION_PIN, TIME_MS2I(POINTING_DEVICE_TASK_THROTTLE_MS));
+        pointing_device_sample();
+    }
+}
+#    endif // POINTING_DEVICE_MOTION_THREAD
+#endif     // POINTING_DEVICE_ACCUMULATE_MOTION
+
 /**
  * @brief Keyboard level code pointing device initialisation
  *
@@ -167,13 +285,23 @@ __attribute__((weak)) void pointing_device_init(void) {
     if ((POINTING_DEVICE_THIS_SIDE))
 #endif
     {
+        pointing_device_lock();
         pointing_device_driver->init();
+        pointing_device_unlock();
 #ifdef POINTING_DEVICE_MOTION_PIN
 #    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
         gpio_set_pin_input_high(POINTING_DEVICE_MOTION_PIN);
 #    else
         gpio_set_pin_input(POINTING_DEVICE_MOTION_PIN);
 #    endif
+#endif
+#ifdef POINTING_DEVICE_MOTION_THREAD
+#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+        palEnableLineEvent(POINTING_DEVICE_MOTION_PIN, PAL_EVENT_MODE_FALLING_EDGE);
+#    else
+        palEnableLineEvent(POINTING_DEVICE_MOTION_PIN, PAL_EVENT_MODE_RISING_EDGE);
+#    endif
+        chThdCreateStatic(waPointingDeviceMotionThread, sizeof(waPointingDeviceMotionThread), NORMALPRIO + 1, PointingDeviceMotionThread, NULL);
 #endif
     }
 
@@ -239,6 +367,17 @@ report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report) {
     return mouse_report;
 }
 
+static inline report_mouse_t pointing_device_read_report(report_mouse_t mouse_report) {
+#ifdef POINTING_DEVICE_ACCUMULATE_MOTION
+    return pointing_device_get_accumulated_report(mouse_report);
+#else
+    pointing_device_lock();
+    mouse_report = pointing_device_driver->get_report(mouse_report);
+    pointing_device_unlock();
+    return mouse_report;
+#endif
+}
+
 /**
  * @brief Retrieves and processes pointing device data.
  *
@@ -254,6 +393,10 @@ __attribute__((weak)) bool pointing_device_task(void) {
     };
 #endif
 
+#if defined(POINTING_DEVICE_ACCUMULATE_MOTION) && !defined(POINTING_DEVICE_MOTION_THREAD)
+    pointing_device_sample();
+#endif
+
 #if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
@@ -263,9 +406,9 @@ __attribute__((weak)) bool pointing_device_task(void) {
 #endif
 
     // Gather report info
-#ifdef POINTING_DEVICE_MOTION_PIN
+#if defined(POINTING_DEVICE_MOTION_PIN) && !defined(POINTING_DEVICE_ACCUMULATE_MOTION)
 #    if defined(SPLIT_POINTING_ENABLE)
-#        error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
+#        error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides, unless POINTING_DEVICE_ACCUMULATE_MOTION is enabled.
 #    endif
 #    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
     if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
@@ -279,18 +422,18 @@ __attribute__((weak)) bool pointing_device_task(void) {
 #    if defined(POINTING_DEVICE_COMBINED)
         static uint8_t old_buttons = 0;
         local_mouse_report.buttons = old_buttons;
-        local_mouse_report         = pointing_device_driver->get_report(local_mouse_report);
+        local_mouse_report         = pointing_device_read_report(local_mouse_report);
         old_buttons                = local_mouse_report.buttons;
 #    elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
-        local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_report(local_mouse_report) : shared_mouse_report;
+        local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_read_report(local_mouse_report) : shared_mouse_report;
 #    else
 #        error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
 #    endif
 #else
-    local_mouse_report = pointing_device_driver->get_report(local_mouse_report);
+    local_mouse_report = pointing_device_read_report(local_mouse_report);
 #endif // defined(SPLIT_POINTING_ENABLE)
 
-#ifdef POINTING_DEVICE_MOTION_PIN
+#if defined(POINTING_DEVICE_MOTION_PIN) && !defined(POINTING_DEVICE_ACCUMULATE_MOTION)
     }
 #endif
 
@@ -304,8 +447,14 @@ __attribute__((weak)) bool pointing_device_task(void) {
         shared_mouse_report = pointing_device_adjust_by_defines(shared_mouse_report);
     }
     local_mouse_report = is_keyboard_left() ? pointing_device_task_combined_kb(local_mouse_report, shared_mouse_report) : pointing_device_task_combined_kb(shared_mouse_report, local_mouse_report);
+#    ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+    local_mouse_report = pointing_device_transform(local_mouse_report);
+#    endif
 #else
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
+#    ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+    local_mouse_report = pointing_device_transform(local_mouse_report);
+#    endif
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
 #endif
     // automatic mouse layer function
@@ -343,6 +492,19 @@ void pointing_device_set_report(report_mouse_t mouse_report) {
     memcpy(&local_mouse_report, &mouse_report, sizeof(local_mouse_report));
 }
 
+static uint16_t pointing_device_driver_read_cpi(void) {
+    pointing_device_lock();
+    uint16_t cpi = pointing_device_driver->get_cpi();
+    pointing_device_unlock();
+    return cpi;
+}
+
+static void pointing_device_driver_write_cpi(uint16_t cpi) {
+    pointing_device_lock();
+    pointing_device_driver->set_cpi(cpi);
+    pointing_device_unlock();
+}
+
 /**
  * @brief Gets current pointing device CPI if supported
  *
@@ -352,9 +514,9 @@ void pointing_device_set_report(report_mouse_t mouse_report) {
  */
 uint16_t pointing_device_get_cpi(void) {
 #if defined(SPLIT_POINTING_ENABLE)
-    return POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_cpi() : shared_cpi;
+    return POINTING_DEVICE_THIS_SIDE ? pointing_device_driver_read_cpi() : shared_cpi;
 #else
-    return pointing_device_driver->get_cpi();
+    return pointing_device_driver_read_cpi();
 #endif
 }
 
@@ -368,12 +530,12 @@ uint16_t pointing_device_get_cpi(void) {
 void pointing_device_set_cpi(uint16_t cpi) {
 #if defined(SPLIT_POINTING_ENABLE)
     if (POINTING_DEVICE_THIS_SIDE) {
-        pointing_device_driver->set_cpi(cpi);
+        pointing_device_driver_write_cpi(cpi);
     } else {
         shared_cpi = cpi;
     }
 #else
-    pointing_device_driver->set_cpi(cpi);
+    pointing_device_driver_write_cpi(cpi);
 #endif
 }
 
@@ -391,7 +553,7 @@ void pointing_device_set_cpi(uint16_t cpi) {
 void pointing_device_set_cpi_on_side(bool left, uint16_t cpi) {
     bool local = (is_keyboard_left() == left);
     if (local) {
-        pointing_device_driver->set_cpi(cpi);
+        pointing_device_driver_write_cpi(cpi);
     } else {
         shared_cpi = cpi;
     }
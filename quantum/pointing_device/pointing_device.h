@@ -32,6 +32,10 @@ typedef struct {
 #    include "pointing_device_auto_mouse.h"
 #endif
 
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+#    include "pointing_device_transform.h"
+#endif
+
 #if defined(POINTING_DEVICE_DRIVER_adns5050)
 #    include "drivers/sensors/adns5050.h"
 #    define POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
@@ -111,6 +115,11 @@ typedef int32_t hv_clamp_range_t;
 typedef int16_t hv_clamp_range_t;
 #endif
 
+#if defined(POINTING_DEVICE_ACCUMULATE_MOTION) && !defined(POINTING_DEVICE_TASK_THROTTLE_MS)
+// One report per frame at the default USB polling interval
+#    define POINTING_DEVICE_TASK_THROTTLE_MS 1
+#endif
+
 #define CONSTRAIN_HID(amt) ((amt) < INT8_MIN ? INT8_MIN : ((amt) > INT8_MAX ? INT8_MAX : (amt)))
 #define CONSTRAIN_HID_XY(amt) ((amt) < XY_REPORT_MIN ? XY_REPORT_MIN : ((amt) > XY_REPORT_MAX ? XY_REPORT_MAX : (amt)))
 
@@ -130,6 +139,11 @@ uint8_t        pointing_device_handle_buttons(uint8_t buttons, bool pressed, poi
 report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report);
 void           pointing_device_keycode_handler(uint16_t keycode, bool pressed);
 
+#ifdef POINTING_DEVICE_ACCUMULATE_MOTION
+bool           pointing_device_sample(void);
+report_mouse_t pointing_device_get_accumulated_report(report_mouse_t mouse_report);
+#endif
+
 #if defined(SPLIT_POINTING_ENABLE)
 void     pointing_device_set_shared_report(report_mouse_t report);
 uint16_t pointing_device_get_shared_cpi(void);
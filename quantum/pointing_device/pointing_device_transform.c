@@ -0,0 +1,234 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+
+#    include "pointing_device.h"
+#    include "pointing_device_transform.h"
+
+/* motion that has been transformed but not yet sent, only whole counts are taken out when quantizing */
+static pointing_device_motion_t remainder      = {0};
+static bool                     is_drag_scroll = false;
+
+/**
+ * @brief Multiplies two fixed point values
+ *
+ * @param[in] a pointing_fixed_t
+ * @param[in] b pointing_fixed_t
+ * @return pointing_fixed_t product, truncated towards zero
+ */
+pointing_fixed_t pointing_fixed_mul(pointing_fixed_t a, pointing_fixed_t b) {
+    return (pointing_fixed_t)(((int64_t)a * b) / POINTING_FIXED_ONE);
+}
+
+/**
+ * @brief Integer square root, rounded down
+ *
+ * @param[in] value uint32_t
+ * @return uint32_t
+ */
+static uint32_t isqrt32(uint32_t value) {
+    uint32_t result = 0;
+    uint32_t bit    = (uint32_t)1 << 30;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+/**
+ * @brief Magnitude of the pointer motion of a single report
+ *
+ * Each axis saturates at just under 2^15 fixed point units (128 counts with the default 8 fractional bits),
+ * so that the sum of squares fits in 32 bits.
+ *
+ * @param[in] x pointing_fixed_t
+ * @param[in] y pointing_fixed_t
+ * @return pointing_fixed_t speed, in counts per report
+ */
+static pointing_fixed_t pointing_device_speed(pointing_fixed_t x, pointing_fixed_t y) {
+    uint32_t ax = x < 0 ? -x : x;
+    uint32_t ay = y < 0 ? -y : y;
+    if (ax > INT16_MAX) ax = INT16_MAX;
+    if (ay > INT16_MAX) ay = INT16_MAX;
+    return isqrt32(ax * ax + ay * ay);
+}
+
+/**
+ * @brief Looks up the gain of a piecewise linear acceleration curve
+ *
+ * Speeds outside of the curve use the gain of the nearest end point.
+ *
+ * @param[in] curve pointing_device_curve_point_t array, sorted by speed
+ * @param[in] count number of points in the curve
+ * @param[in] speed pointing_fixed_t
+ * @return pointing_fixed_t gain
+ */
+pointing_fixed_t pointing_device_curve_gain(const pointing_device_curve_point_t *curve, uint8_t count, pointing_fixed_t speed) {
+    if (count == 0) {
+        return POINTING_FIXED_ONE;
+    }
+    if (speed <= curve[0].speed) {
+        return curve[0].gain;
+    }
+    for (uint8_t i = 1; i < count; i++) {
+        if (speed < curve[i].speed) {
+            const pointing_device_curve_point_t *from = &curve[i - 1];
+            const pointing_device_curve_point_t *to   = &curve[i];
+            return from->gain + (pointing_fixed_t)(((int64_t)(to->gain - from->gain) * (speed - from->speed)) / (to->speed - from->speed));
+        }
+    }
+    return curve[count - 1].gain;
+}
+
+/**
+ * @brief Takes the whole counts out of a fixed point remainder
+ *
+ * Anything beyond the report range is kept in the remainder, to be sent with the next report.
+ *
+ * @param[in,out] pending pointing_fixed_t remainder
+ * @param[in] min smallest value the report can hold
+ * @param[in] max largest value the report can hold
+ * @return int32_t counts to send
+ */
+static int32_t pointing_device_quantize(pointing_fixed_t *pending, int32_t min, int32_t max) {
+    int32_t counts = *pending / POINTING_FIXED_ONE;
+    if (counts < min) {
+        counts = min;
+    } else if (counts > max) {
+        counts = max;
+    }
+    *pending -= counts * POINTING_FIXED_ONE;
+    return counts;
+}
+
+/**
+ * @brief Runs a mouse report through the fixed point transform pipeline
+ *
+ * Applies acceleration and drag scroll, followed by the keyboard and user transforms, keeping the fractional
+ * remainders between reports so that motion is only ever quantized once.
+ *
+ * @param[in] mouse_report report_mouse_t
+ * @return report_mouse_t with transformed motion
+ */
+report_mouse_t pointing_device_transform(report_mouse_t mouse_report) {
+    pointing_device_motion_t motion = {
+        .x = (pointing_fixed_t)mouse_report.x * POINTING_FIXED_ONE,
+        .y = (pointing_fixed_t)mouse_report.y * POINTING_FIXED_ONE,
+        .h = (pointing_fixed_t)mouse_report.h * POINTING_FIXED_ONE,
+        .v = (pointing_fixed_t)mouse_report.v * POINTING_FIXED_ONE,
+    };
+
+    if (motion.x || motion.y) {
+        pointing_fixed_t gain = pointing_device_acceleration_kb(pointing_device_speed(motion.x, motion.y));
+        if (gain != POINTING_FIXED_ONE) {
+            motion.x = pointing_fixed_mul(motion.x, gain);
+            motion.y = pointing_fixed_mul(motion.y, gain);
+        }
+    }
+
+    if (is_drag_scroll) {
+        motion.h += motion.x / POINTING_DEVICE_DRAG_SCROLL_DIVISOR_H;
+#    ifdef POINTING_DEVICE_DRAG_SCROLL_INVERT
+        motion.v -= motion.y / POINTING_DEVICE_DRAG_SCROLL_DIVISOR_V;
+#    else
+        motion.v += motion.y / POINTING_DEVICE_DRAG_SCROLL_DIVISOR_V;
+#    endif
+        motion.x = 0;
+        motion.y = 0;
+    }
+
+    motion = pointing_device_transform_kb(motion);
+
+    remainder.x += motion.x;
+    remainder.y += motion.y;
+    remainder.h += motion.h;
+    remainder.v += motion.v;
+    mouse_report.x = pointing_device_quantize(&remainder.x, XY_REPORT_MIN, XY_REPORT_MAX);
+    mouse_report.y = pointing_device_quantize(&remainder.y, XY_REPORT_MIN, XY_REPORT_MAX);
+    mouse_report.h = pointing_device_quantize(&remainder.h, HV_REPORT_MIN, HV_REPORT_MAX);
+    mouse_report.v = pointing_device_quantize(&remainder.v, HV_REPORT_MIN, HV_REPORT_MAX);
+    return mouse_report;
+}
+
+/**
+ * @brief Discards any motion that hasn't been sent yet
+ */
+void pointing_device_transform_reset(void) {
+    remainder = (pointing_device_motion_t){0};
+}
+
+/**
+ * @brief Enables or disables drag scroll
+ *
+ * While enabled, pointer motion is divided by POINTING_DEVICE_DRAG_SCROLL_DIVISOR_H/V and sent as scrolling instead.
+ *
+ * @param[in] enable bool
+ */
+void pointing_device_set_drag_scroll(bool enable) {
+    if (enable != is_drag_scroll) {
+        is_drag_scroll = enable;
+        pointing_device_transform_reset();
+    }
+}
+
+/**
+ * @brief Gets the current drag scroll state
+ *
+ * @return bool true if drag scroll is enabled
+ */
+bool pointing_device_get_drag_scroll(void) {
+    return is_drag_scroll;
+}
+
+/**
+ * @brief Weak function allowing for keyboard level acceleration curves
+ *
+ * @param[in] speed pointing_fixed_t magnitude of the pointer motion, in counts per report
+ * @return pointing_fixed_t gain to apply to the pointer motion
+ */
+__attribute__((weak)) pointing_fixed_t pointing_device_acceleration_kb(pointing_fixed_t speed) {
+    return pointing_device_acceleration_user(speed);
+}
+
+/**
+ * @brief Weak function allowing for user level acceleration curves
+ *
+ * @param[in] speed pointing_fixed_t magnitude of the pointer motion, in counts per report
+ * @return pointing_fixed_t gain to apply to the pointer motion, POINTING_FIXED_ONE by default
+ */
+__attribute__((weak)) pointing_fixed_t pointing_device_acceleration_user(pointing_fixed_t speed) {
+    return POINTING_FIXED_ONE;
+}
+
+/**
+ * @brief Weak function allowing for keyboard level modification of the fixed point motion
+ *
+ * @param[in] motion pointing_device_motion_t
+ * @return pointing_device_motion_t
+ */
+__attribute__((weak)) pointing_device_motion_t pointing_device_transform_kb(pointing_device_motion_t motion) {
+    return pointing_device_transform_user(motion);
+}
+
+/**
+ * @brief Weak function allowing for user level modification of the fixed point motion
+ *
+ * @param[in] motion pointing_device_motion_t
+ * @return pointing_device_motion_t
+ */
+__attribute__((weak)) pointing_device_motion_t pointing_device_transform_user(pointing_device_motion_t motion) {
+    return motion;
+}
+
+#endif // POINTING_DEVICE_TRANSFORM_ENABLE
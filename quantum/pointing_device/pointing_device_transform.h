@@ -0,0 +1,61 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "report.h"
+
+/* check settings and set defaults */
+#ifndef POINTING_DEVICE_TRANSFORM_ENABLE
+#    error "POINTING_DEVICE_TRANSFORM_ENABLE not defined! check config settings"
+#endif
+
+#ifndef POINTING_DEVICE_TRANSFORM_FRACTION_BITS
+#    define POINTING_DEVICE_TRANSFORM_FRACTION_BITS 8
+#endif
+#ifndef POINTING_DEVICE_DRAG_SCROLL_DIVISOR_H
+#    define POINTING_DEVICE_DRAG_SCROLL_DIVISOR_H 8
+#endif
+#ifndef POINTING_DEVICE_DRAG_SCROLL_DIVISOR_V
+#    define POINTING_DEVICE_DRAG_SCROLL_DIVISOR_V 8
+#endif
+
+/* fixed point motion, in counts with POINTING_DEVICE_TRANSFORM_FRACTION_BITS fractional bits */
+typedef int32_t pointing_fixed_t;
+
+#define POINTING_FIXED_ONE ((pointing_fixed_t)1 << POINTING_DEVICE_TRANSFORM_FRACTION_BITS)
+/* converts a constant, e.g. POINTING_FIXED(1.5), without pulling floating point into the firmware */
+#define POINTING_FIXED(value) ((pointing_fixed_t)((value) * POINTING_FIXED_ONE))
+
+typedef struct {
+    pointing_fixed_t x;
+    pointing_fixed_t y;
+    pointing_fixed_t h;
+    pointing_fixed_t v;
+} pointing_device_motion_t;
+
+/* point of a piecewise linear acceleration curve, sorted by speed */
+typedef struct {
+    pointing_fixed_t speed; /* counts per report */
+    pointing_fixed_t gain;  /* multiplier applied at that speed */
+} pointing_device_curve_point_t;
+
+/* ----------Transform pipeline------------------------------------------------------------------------------------- */
+report_mouse_t pointing_device_transform(report_mouse_t mouse_report);
+void           pointing_device_transform_reset(void);
+
+/* ----------Drag scroll-------------------------------------------------------------------------------------------- */
+void pointing_device_set_drag_scroll(bool enable);
+bool pointing_device_get_drag_scroll(void);
+
+/* ----------Fixed point helpers----------------------------------------------------------------------------------- */
+pointing_fixed_t pointing_fixed_mul(pointing_fixed_t a, pointing_fixed_t b);
+pointing_fixed_t pointing_device_curve_gain(const pointing_device_curve_point_t *curve, uint8_t count, pointing_fixed_t speed);
+
+/* ----------Callbacks for modifying and using transform----------------------------------------------------------- */
+pointing_fixed_t         pointing_device_acceleration_kb(pointing_fixed_t speed);
+pointing_fixed_t         pointing_device_acceleration_user(pointing_fixed_t speed);
+pointing_device_motion_t pointing_device_transform_kb(pointing_device_motion_t motion);
+pointing_device_motion_t pointing_device_transform_user(pointing_device_motion_t motion);
@@ -19,6 +19,22 @@
 #    include "autocorrect_data_default.h"
 #endif
 
+// Data generated before node links could be widened always uses 16-bit links
+#ifndef AUTOCORRECT_DATA_LINK_BYTES
+#    define AUTOCORRECT_DATA_LINK_BYTES 2
+#endif
+
+#if AUTOCORRECT_DATA_LINK_BYTES == 2
+typedef uint16_t autocorrect_offset_t;
+#elif AUTOCORRECT_DATA_LINK_BYTES == 3
+#    if defined(__AVR__)
+#        error "Autocorrect dictionaries needing 24-bit node links are too large for AVR"
+#    endif
+typedef uint32_t autocorrect_offset_t;
+#else
+#    error "AUTOCORRECT_DATA_LINK_BYTES must be 2 or 3"
+#endif
+
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
@@ -189,6 +205,20 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+/**
+ * @brief Reads a little endian link to a trie node
+ *
+ * @param offset location of the link within `autocorrect_data`
+ * @return offset of the linked node
+ */
+static inline autocorrect_offset_t autocorrect_read_link(autocorrect_offset_t offset) {
+    autocorrect_offset_t link = pgm_read_byte(autocorrect_data + offset) | (autocorrect_offset_t)pgm_read_byte(autocorrect_data + offset + 1) << 8;
+#if AUTOCORRECT_DATA_LINK_BYTES == 3
+    link |= (autocorrect_offset_t)pgm_read_byte(autocorrect_data + offset + 2) << 16;
+#endif
+    return link;
+}
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -280,18 +310,18 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     }
 
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
+    autocorrect_offset_t state = 0;
+    uint8_t              code  = pgm_read_byte(autocorrect_data + state);
     for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
         uint8_t const key_i = typo_buffer[i];
 
         if (code & 64) { // Check for match in node with multiple children.
             code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 1 + AUTOCORRECT_DATA_LINK_BYTES))) {
                 if (!code) return true;
             }
             // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
+            state = autocorrect_read_link(state + 1);
             // Check for match in node with single child.
         } else if (code != key_i) {
             return true;
@@ -22,10 +22,14 @@
 #include "timer.h"
 #include "wait.h"
 #include "keymap_introspection.h"
+#include "timer_wheel.h"
 
 static uint16_t active_td;
 static uint16_t last_tap_time;
 
+/** @brief Wakes up tap_dance_task() once the active dance's tapping term is due. */
+static timer_wheel_timer_t tapping_term_timeout = TIMER_WHEEL_TIMER(tap_dance_task);
+
 void tap_dance_pair_on_each_tap(tap_dance_state_t *state, void *user_data) {
     tap_dance_pair_t *pair = (tap_dance_pair_t *)user_data;
 
@@ -80,64 +84,155 @@ void tap_dance_dual_role_reset(tap_dance_state_t *state, void *user_data) {
     }
 }
 
+static uint16_t tap_dance_keys_resolve(tap_dance_state_t *state, const tap_dance_keys_t *keys) {
+    bool held = state->pressed && !state->interrupted;
+
+    if (state->count == 1) {
+        return held && keys->hold != KC_NO ? keys->hold : keys->tap;
+    }
+    if (state->count == 2) {
+        if (held && keys->double_hold != KC_NO) {
+            return keys->double_hold;
+        }
+        return keys->double_tap;
+    }
+    return KC_NO;
+}
+
+void tap_dance_keys_finished(tap_dance_state_t *state, void *user_data) {
+    const tap_dance_keys_t *keys    = (const tap_dance_keys_t *)user_data;
+    uint16_t                keycode = tap_dance_keys_resolve(state, keys);
+
+    if (keycode == KC_NO) {
+        // Nothing is configured for this many taps, so send them as individual taps
+        for (uint8_t i = 1; i < state->count; i++) {
+            tap_code16(keys->tap);
+        }
+        keycode = keys->tap;
+    }
+    register_code16(keycode);
+    state->registered_keycode = keycode;
+}
+
+void tap_dance_keys_reset(tap_dance_state_t *state, void *user_data) {
+    if (state->registered_keycode != KC_NO) {
+        wait_ms(TAP_CODE_DELAY);
+        unregister_code16(state->registered_keycode);
+    }
+}
+
+// Returns where the slot of a dance of tap_dance_actions is kept, or NULL for dances only known to tap_dance_get()
+static uint8_t *tap_dance_slot(uint8_t tap_dance_idx) {
+    uint16_t count;
+    uint8_t *slots = tap_dance_slots_raw(&count);
+    return tap_dance_idx < count ? &slots[tap_dance_idx] : NULL;
+}
+
+// Only dances that are in progress or still held need state, so it lives in a pool rather than alongside every action
+static tap_dance_state_t *tap_dance_allocate_state(uint8_t tap_dance_idx) {
+    uint16_t           count;
+    tap_dance_state_t *states = tap_dance_states_raw(&count);
+    for (uint16_t i = 0; i < count; i++) {
+        if (!states[i].in_use) {
+            states[i]        = (const tap_dance_state_t){0};
+            states[i].in_use = true;
+            states[i].index  = tap_dance_idx;
+
+            uint8_t *slot = tap_dance_slot(tap_dance_idx);
+            if (slot) {
+                *slot = i + 1;
+            }
+            return &states[i];
+        }
+    }
+    return NULL;
+}
+
+static void tap_dance_release_state(tap_dance_state_t *state) {
+    if (state->in_use) {
+        uint8_t *slot = tap_dance_slot(state->index);
+        if (slot) {
+            *slot = 0;
+        }
+    }
+    *state = (const tap_dance_state_t){0};
+}
+
+tap_dance_state_t *tap_dance_get_state(uint8_t tap_dance_idx) {
+    uint16_t           count;
+    tap_dance_state_t *states = tap_dance_states_raw(&count);
+
+    uint8_t *slot = tap_dance_slot(tap_dance_idx);
+    if (slot) {
+        return *slot ? &states[*slot - 1] : NULL;
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        if (states[i].in_use && states[i].index == tap_dance_idx) {
+            return &states[i];
+        }
+    }
+    return NULL;
+}
+
 static inline void _process_tap_dance_action_fn(tap_dance_state_t *state, void *user_data, tap_dance_user_fn_t fn) {
     if (fn) {
         fn(state, user_data);
     }
 }
 
-static inline void process_tap_dance_action_on_each_tap(tap_dance_action_t *action) {
-    action->state.count++;
-    action->state.weak_mods = get_mods();
-    action->state.weak_mods |= get_weak_mods();
+static inline void process_tap_dance_action_on_each_tap(const tap_dance_action_t *action, tap_dance_state_t *state) {
+    state->count++;
+    state->weak_mods = get_mods();
+    state->weak_mods |= get_weak_mods();
 #ifndef NO_ACTION_ONESHOT
-    action->state.oneshot_mods = get_oneshot_mods();
+    state->oneshot_mods = get_oneshot_mods();
 #endif
-    _process_tap_dance_action_fn(&action->state, action->user_data, action->fn.on_each_tap);
+    _process_tap_dance_action_fn(state, action->user_data, action->fn.on_each_tap);
 }
 
-static inline void process_tap_dance_action_on_each_release(tap_dance_action_t *action) {
-    _process_tap_dance_action_fn(&action->state, action->user_data, action->fn.on_each_release);
+static inline void process_tap_dance_action_on_each_release(const tap_dance_action_t *action, tap_dance_state_t *state) {
+    _process_tap_dance_action_fn(state, action->user_data, action->fn.on_each_release);
 }
 
-static inline void process_tap_dance_action_on_reset(tap_dance_action_t *action) {
-    _process_tap_dance_action_fn(&action->state, action->user_data, action->fn.on_reset);
-    del_weak_mods(action->state.weak_mods);
+static inline void process_tap_dance_action_on_reset(const tap_dance_action_t *action, tap_dance_state_t *state) {
+    _process_tap_dance_action_fn(state, action->user_data, action->fn.on_reset);
+    del_weak_mods(state->weak_mods);
 #ifndef NO_ACTION_ONESHOT
-    del_mods(action->state.oneshot_mods);
+    del_mods(state->oneshot_mods);
 #endif
     send_keyboard_report();
-    action->state = (const tap_dance_state_t){0};
+    tap_dance_release_state(state);
 }
 
-static inline void process_tap_dance_action_on_dance_finished(tap_dance_action_t *action) {
-    if (!action->state.finished) {
-        action->state.finished = true;
-        add_weak_mods(action->state.weak_mods);
+static inline void process_tap_dance_action_on_dance_finished(const tap_dance_action_t *action, tap_dance_state_t *state) {
+    if (!state->finished) {
+        state->finished = true;
+        add_weak_mods(state->weak_mods);
 #ifndef NO_ACTION_ONESHOT
-        add_mods(action->state.oneshot_mods);
+        add_mods(state->oneshot_mods);
 #endif
         send_keyboard_report();
-        _process_tap_dance_action_fn(&action->state, action->user_data, action->fn.on_dance_finished);
+        _process_tap_dance_action_fn(state, action->user_data, action->fn.on_dance_finished);
     }
     active_td = 0;
-    if (!action->state.pressed) {
+    timer_wheel_cancel(&tapping_term_timeout);
+    if (!state->pressed) {
         // There will not be a key release event, so reset now.
-        process_tap_dance_action_on_reset(action);
+        process_tap_dance_action_on_reset(action, state);
     }
 }
 
 bool preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
-    tap_dance_action_t *action;
+    tap_dance_state_t *state;
 
     if (!record->event.pressed) return false;
 
     if (!active_td || keycode == active_td) return false;
 
-    action                             = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
-    action->state.interrupted          = true;
-    action->state.interrupting_keycode = keycode;
-    process_tap_dance_action_on_dance_finished(action);
+    state                       = tap_dance_get_state(QK_TAP_DANCE_GET_INDEX(active_td));
+    state->interrupted          = true;
+    state->interrupting_keycode = keycode;
+    process_tap_dance_action_on_dance_finished(tap_dance_get(state->index), state);
 
     // Tap dance actions can leave some weak mods active (e.g., if the tap dance is mapped to a keycode with
     // modifiers), but these weak mods should not affect the keypress which interrupted the tap dance.
@@ -151,8 +246,9 @@ bool preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
 }
 
 bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
-    int                 td_index;
-    tap_dance_action_t *action;
+    int                       td_index;
+    const tap_dance_action_t *action;
+    tap_dance_state_t        *state;
 
     switch (keycode) {
         case QK_TAP_DANCE ... QK_TAP_DANCE_MAX:
@@ -161,16 +257,32 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
                 return false;
             }
             action = tap_dance_get(td_index);
+            state  = tap_dance_get_state(td_index);
 
-            action->state.pressed = record->event.pressed;
             if (record->event.pressed) {
-                last_tap_time = timer_read();
-                process_tap_dance_action_on_each_tap(action);
-                active_td = action->state.finished ? 0 : keycode;
-            } else {
-                process_tap_dance_action_on_each_release(action);
-                if (action->state.finished) {
-                    process_tap_dance_action_on_reset(action);
+                if (!state) {
+                    state = tap_dance_allocate_state(td_index);
+                    if (!state) {
+                        // Too many dances in progress, so this one can't start. The key goes on like any other.
+                        dprintf("tap dance: no free state for TD(%d), increase TAP_DANCE_MAX_SIMULTANEOUS\n", td_index);
+                        break;
+                    }
+                }
+                state->pressed = true;
+                last_tap_time  = timer_read();
+                process_tap_dance_action_on_each_tap(action, state);
+                if (state->in_use && !state->finished) {
+                    active_td = keycode;
+                    tap_dance_task();
+                } else {
+                    active_td = 0;
+                    timer_wheel_cancel(&tapping_term_timeout);
+                }
+            } else if (state) {
+                state->pressed = false;
+                process_tap_dance_action_on_each_release(action, state);
+                if (state->finished) {
+                    process_tap_dance_action_on_reset(action, state);
                     if (active_td == keycode) {
                         active_td = 0;
                     }
@@ -184,17 +296,30 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 }
 
 void tap_dance_task(void) {
-    tap_dance_action_t *action;
-
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+    tap_dance_state_t *state;
+    uint16_t           tapping_term;
+    uint16_t           elapsed;
+
+    if (!active_td) return;
+
+    // The tapping term may differ between keys or change at runtime, so it's checked afresh whenever the timer fires
+    tapping_term = GET_TAPPING_TERM(active_td, &(keyrecord_t){});
+    elapsed      = timer_elapsed(last_tap_time);
+    if (elapsed <= tapping_term) {
+        timer_wheel_schedule(&tapping_term_timeout, tapping_term - elapsed + 1);
+        return;
+    }
 
-    action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
-    if (!action->state.interrupted) {
-        process_tap_dance_action_on_dance_finished(action);
+    state = tap_dance_get_state(QK_TAP_DANCE_GET_INDEX(active_td));
+    if (!state->interrupted) {
+        process_tap_dance_action_on_dance_finished(tap_dance_get(state->index), state);
     }
 }
 
 void reset_tap_dance(tap_dance_state_t *state) {
-    active_td = 0;
-    process_tap_dance_action_on_reset((tap_dance_action_t *)state);
+    if (active_td == TAP_DANCE_KEYCODE(state)) {
+        active_td = 0;
+        timer_wheel_cancel(&tapping_term_timeout);
+    }
+    process_tap_dance_action_on_reset(tap_dance_get(state->index), state);
 }
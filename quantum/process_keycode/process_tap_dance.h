@@ -21,8 +21,15 @@
 #include "action.h"
 #include "quantum_keycodes.h"
 
-typedef struct {
+// How many dances can be in progress or held at once
+#ifndef TAP_DANCE_MAX_SIMULTANEOUS
+#    define TAP_DANCE_MAX_SIMULTANEOUS 8
+#endif
+
+typedef struct tap_dance_state_t {
     uint16_t interrupting_keycode;
+    uint16_t registered_keycode; // keycode held down by ACTION_TAP_DANCE_KEYS() until the dance resets
+    uint8_t  index;
     uint8_t  count;
     uint8_t  weak_mods;
 #ifndef NO_ACTION_ONESHOT
@@ -31,12 +38,12 @@ typedef struct {
     bool pressed : 1;
     bool finished : 1;
     bool interrupted : 1;
+    bool in_use : 1;
 } tap_dance_state_t;
 
 typedef void (*tap_dance_user_fn_t)(tap_dance_state_t *state, void *user_data);
 
 typedef struct tap_dance_action_t {
-    tap_dance_state_t state;
     struct {
         tap_dance_user_fn_t on_each_tap;
         tap_dance_user_fn_t on_dance_finished;
@@ -57,6 +64,13 @@ typedef struct {
     void (*layer_function)(uint8_t);
 } tap_dance_dual_role_t;
 
+typedef struct {
+    uint16_t tap;
+    uint16_t hold;
+    uint16_t double_tap;
+    uint16_t double_hold;
+} tap_dance_keys_t;
+
 #define ACTION_TAP_DANCE_DOUBLE(kc1, kc2) \
     { .fn = {tap_dance_pair_on_each_tap, tap_dance_pair_finished, tap_dance_pair_reset, NULL}, .user_data = (void *)&((tap_dance_pair_t){kc1, kc2}), }
 
@@ -66,6 +80,9 @@ typedef struct {
 #define ACTION_TAP_DANCE_LAYER_TOGGLE(kc, layer) \
     { .fn = {NULL, tap_dance_dual_role_finished, tap_dance_dual_role_reset, NULL}, .user_data = (void *)&((tap_dance_dual_role_t){kc, layer, layer_invert}), }
 
+#define ACTION_TAP_DANCE_KEYS(tap, hold, double_tap, double_hold) \
+    { .fn = {NULL, tap_dance_keys_finished, tap_dance_keys_reset, NULL}, .user_data = (void *)&((const tap_dance_keys_t){tap, hold, double_tap, double_hold}), }
+
 #define ACTION_TAP_DANCE_FN(user_fn) \
     { .fn = {NULL, user_fn, NULL, NULL}, .user_data = NULL, }
 
@@ -76,10 +93,18 @@ typedef struct {
     { .fn = {user_fn_on_each_tap, user_fn_on_dance_finished, user_fn_on_dance_reset, user_fn_on_each_release}, .user_data = NULL, }
 
 #define TD_INDEX(code) QK_TAP_DANCE_GET_INDEX(code)
-#define TAP_DANCE_KEYCODE(state) TD(((tap_dance_action_t *)state) - tap_dance_actions)
+#define TAP_DANCE_KEYCODE(state) TD((state)->index)
 
 void reset_tap_dance(tap_dance_state_t *state);
 
+/**
+ * Retrieves the state of a tap dance that is currently in progress.
+ *
+ * @param tap_dance_idx[in] the index of the tap dance within tap_dance_actions
+ * @return the state of the dance, or NULL if it isn't being danced or held
+ */
+tap_dance_state_t *tap_dance_get_state(uint8_t tap_dance_idx);
+
 /* To be used internally */
 
 bool preprocess_tap_dance(uint16_t keycode, keyrecord_t *record);
@@ -93,3 +118,6 @@ void tap_dance_pair_reset(tap_dance_state_t *state, void *user_data);
 void tap_dance_dual_role_on_each_tap(tap_dance_state_t *state, void *user_data);
 void tap_dance_dual_role_finished(tap_dance_state_t *state, void *user_data);
 void tap_dance_dual_role_reset(tap_dance_state_t *state, void *user_data);
+
+void tap_dance_keys_finished(tap_dance_state_t *state, void *user_data);
+void tap_dance_keys_reset(tap_dance_state_t *state, void *user_data);
@@ -187,8 +187,10 @@ uint64_t eeconfig_read_rgblight(void) {
 void eeconfig_update_rgblight(uint64_t val) {
 #ifdef EEPROM_ENABLE
     rgblight_check_config();
+    eeconfig_transaction_begin();
     eeprom_update_dword(EECONFIG_RGBLIGHT, val & 0xFFFFFFFF);
     eeprom_update_byte(EECONFIG_RGBLIGHT_EXTENDED, (val >> 32) & 0xFF);
+    eeconfig_transaction_commit();
 #endif
 }
 
@@ -1,48 +1,143 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
 #pragma once
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "atomic_util.h"
 
-#ifndef RBUF_SIZE
-#    define RBUF_SIZE 32
-#endif
+// Typed single-producer/single-consumer ring buffers.
+//
+// One context (for example an ISR) may push while another one (for example the
+// main loop) pops, without either of them disabling interrupts: each index is
+// only ever written by one side, and the element is written before the index
+// publishing it. Several producers or several consumers still need a lock.
+//
+// The size must be a power of two, no larger than 256. One slot is kept free to
+// tell a full buffer from an empty one, so a buffer holds up to size - 1 elements.
+//
+//     RING_BUFFER_DEFINE(event_queue, my_event_t, 16);
+//     static event_queue_t events;
+//
+//     event_queue_push(&events, event);       // producer
+//     while (event_queue_pop(&events, &event)) // consumer
+//
+// RING_BUFFER_IMPLEMENT() provides the same functions for an existing struct,
+// which must have uint8_t `head` and `tail` members and an array of elements.
 
-static uint8_t     rbuf[RBUF_SIZE];
-static uint8_t     rbuf_head = 0;
-static uint8_t     rbuf_tail = 0;
-static inline bool rbuf_enqueue(uint8_t data) {
-    bool ret = false;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        uint8_t next = (rbuf_head + 1) % RBUF_SIZE;
-        if (next != rbuf_tail) {
-            rbuf[rbuf_head] = data;
-            rbuf_head       = next;
-            ret             = true;
-        }
-    }
-    return ret;
+#if defined(__AVR__)
+// Byte loads and stores are atomic, and there's only one core: only the compiler
+// needs to be kept from reordering the accesses around the index.
+static inline uint8_t ring_buffer_load_index(const uint8_t *index) {
+    uint8_t value = *(const volatile uint8_t *)index;
+    __asm__ __volatile__("" ::: "memory");
+    return value;
 }
-static inline uint8_t rbuf_dequeue(void) {
-    uint8_t val = 0;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        if (rbuf_head != rbuf_tail) {
-            val       = rbuf[rbuf_tail];
-            rbuf_tail = (rbuf_tail + 1) % RBUF_SIZE;
-        }
-    }
-
-    return val;
+
+static inline void ring_buffer_store_index(uint8_t *index, uint8_t value) {
+    __asm__ __volatile__("" ::: "memory");
+    *(volatile uint8_t *)index = value;
 }
-static inline bool rbuf_has_data(void) {
-    bool has_data;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        has_data = (rbuf_head != rbuf_tail);
-    }
-    return has_data;
+#else
+static inline uint8_t ring_buffer_load_index(const uint8_t *index) {
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
 }
-static inline void rbuf_clear(void) {
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        rbuf_head = rbuf_tail = 0;
-    }
+
+static inline void ring_buffer_store_index(uint8_t *index, uint8_t value) {
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
 }
+#endif
+
+#ifdef __cplusplus
+#    define RING_BUFFER_STATIC_ASSERT static_assert
+#else
+#    define RING_BUFFER_STATIC_ASSERT _Static_assert
+#endif
+
+// Smallest valid ring buffer size of at least `n`.
+#define RING_BUFFER_SIZE_FOR(n) ((n) <= 2 ? 2 : (n) <= 4 ? 4 : (n) <= 8 ? 8 : (n) <= 16 ? 16 : (n) <= 32 ? 32 : (n) <= 64 ? 64 : (n) <= 128 ? 128 : 256)
+
+#define RING_BUFFER_DEFINE(name, element_type, size) \
+    typedef struct {                                 \
+        uint8_t      head;                           \
+        uint8_t      tail;                           \
+        element_type buffer[size];                   \
+    } name##_t;                                      \
+    RING_BUFFER_IMPLEMENT(name, name##_t, element_type, size, buffer)
+
+#define RING_BUFFER_IMPLEMENT(name, ring_type, element_type, size, buffer)                                    \
+    /* Empties the buffer, while neither side is using it */                                                  \
+    static inline void name##_clear(ring_type *rb) {                                                          \
+        rb->head = 0;                                                                                         \
+        rb->tail = 0;                                                                                         \
+    }                                                                                                         \
+                                                                                                              \
+    static inline uint8_t name##_count(const ring_type *rb) {                                                 \
+        return (ring_buffer_load_index(&rb->head) - ring_buffer_load_index(&rb->tail)) & ((size) - 1);        \
+    }                                                                                                         \
+                                                                                                              \
+    static inline bool name##_empty(const ring_type *rb) {                                                    \
+        return ring_buffer_load_index(&rb->head) == ring_buffer_load_index(&rb->tail);                        \
+    }                                                                                                         \
+                                                                                                              \
+    static inline bool name##_full(const ring_type *rb) {                                                     \
+        return ((ring_buffer_load_index(&rb->head) + 1) & ((size) - 1)) == ring_buffer_load_index(&rb->tail); \
+    }                                                                                                         \
+                                                                                                              \
+    /* Producer side */                                                                                       \
+    static inline bool name##_push(ring_type *rb, element_type value) {                                       \
+        uint8_t head = rb->head;                                                                              \
+        uint8_t next = (head + 1) & ((size) - 1);                                                             \
+        if (next == ring_buffer_load_index(&rb->tail)) {                                                      \
+            return false;                                                                                     \
+        }                                                                                                     \
+        rb->buffer[head] = value;                                                                             \
+        ring_buffer_store_index(&rb->head, next);                                                             \
+        return true;                                                                                          \
+    }                                                                                                         \
+                                                                                                              \
+    /* Producer side, returns how many of the values fitted */                                                \
+    static inline uint8_t name##_push_bulk(ring_type *rb, const element_type *values, uint8_t count) {        \
+        uint8_t head = rb->head;                                                                              \
+        uint8_t room = (ring_buffer_load_index(&rb->tail) - head - 1) & ((size) - 1);                         \
+        if (count > room) {                                                                                   \
+            count = room;                                                                                     \
+        }                                                                                                     \
+        for (uint8_t i = 0; i < count; i++) {                                                                 \
+            rb->buffer[(head + i) & ((size) - 1)] = values[i];                                                \
+        }                                                                                                     \
+        ring_buffer_store_index(&rb->head, (head + count) & ((size) - 1));                                    \
+        return count;                                                                                         \
+    }                                                                                                         \
+                                                                                                              \
+    /* Consumer side */                                                                                       \
+    static inline bool name##_pop(ring_type *rb, element_type *value) {                                       \
+        uint8_t tail = rb->tail;                                                                              \
+        if (tail == ring_buffer_load_index(&rb->head)) {                                                      \
+            return false;                                                                                     \
+        }                                                                                                     \
+        *value = rb->buffer[tail];                                                                            \
+        ring_buffer_store_index(&rb->tail, (tail + 1) & ((size) - 1));                                        \
+        return true;                                                                                          \
+    }                                                                                                         \
+                                                                                                              \
+    /* Consumer side, returns how many values were taken */                                                   \
+    static inline uint8_t name##_pop_bulk(ring_type *rb, element_type *values, uint8_t count) {               \
+        uint8_t tail      = rb->tail;                                                                         \
+        uint8_t available = (ring_buffer_load_index(&rb->head) - tail) & ((size) - 1);                        \
+        if (count > available) {                                                                              \
+            count = available;                                                                                \
+        }                                                                                                     \
+        for (uint8_t i = 0; i < count; i++) {                                                                 \
+            values[i] = rb->buffer[(tail + i) & ((size) - 1)];                                                \
+        }                                                                                                     \
+        ring_buffer_store_index(&rb->tail, (tail + count) & ((size) - 1));                                    \
+        return count;                                                                                         \
+    }                                                                                                         \
+                                                                                                              \
+    /* Consumer side, drops everything pushed so far */                                                       \
+    static inline void name##_drain(ring_type *rb) {                                                          \
+        ring_buffer_store_index(&rb->tail, ring_buffer_load_index(&rb->head));                                \
+    }                                                                                                         \
+                                                                                                              \
+    RING_BUFFER_STATIC_ASSERT((size) >= 2 && (size) <= 256 && ((size) & ((size) - 1)) == 0, #name " size must be a power of two")
@@ -3,6 +3,7 @@
 
 #include "secure.h"
 #include "timer.h"
+#include "timer_wheel.h"
 #include "util.h"
 
 #ifndef SECURE_UNLOCK_TIMEOUT
@@ -24,6 +25,9 @@ static secure_status_t secure_status = SECURE_LOCKED;
 static uint32_t        unlock_time   = 0;
 static uint32_t        idle_time     = 0;
 
+// Wakes up secure_task() once the unlock or idle timeout is due
+static timer_wheel_timer_t secure_timeout = TIMER_WHEEL_TIMER(secure_task);
+
 static void secure_hook(secure_status_t secure_status) {
     secure_hook_quantum(secure_status);
     secure_hook_kb(secure_status);
@@ -41,6 +45,9 @@ void secure_lock(void) {
 void secure_unlock(void) {
     secure_status = SECURE_UNLOCKED;
     idle_time     = timer_read32();
+#if SECURE_IDLE_TIMEOUT != 0
+    timer_wheel_schedule(&secure_timeout, SECURE_IDLE_TIMEOUT);
+#endif
     secure_hook(secure_status);
 }
 
@@ -48,6 +55,9 @@ void secure_request_unlock(void) {
     if (secure_status == SECURE_LOCKED) {
         secure_status = SECURE_PENDING;
         unlock_time   = timer_read32();
+#if SECURE_UNLOCK_TIMEOUT != 0
+        timer_wheel_schedule(&secure_timeout, SECURE_UNLOCK_TIMEOUT);
+#endif
     }
     secure_hook(secure_status);
 }
@@ -55,6 +65,9 @@ void secure_request_unlock(void) {
 void secure_activity_event(void) {
     if (secure_status == SECURE_UNLOCKED) {
         idle_time = timer_read32();
+#if SECURE_IDLE_TIMEOUT != 0
+        timer_wheel_schedule(&secure_timeout, SECURE_IDLE_TIMEOUT);
+#endif
     }
 }
 
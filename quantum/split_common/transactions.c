@@ -745,6 +745,9 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
         return;
     }
 #    endif
+#    if defined(POINTING_DEVICE_ACCUMULATE_MOTION) && !defined(POINTING_DEVICE_MOTION_THREAD)
+    pointing_device_sample();
+#    endif
 #    if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
@@ -753,7 +756,9 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     last_exec = timer_read32();
 #    endif
 
+    pointing_device_lock();
     uint16_t temp_cpi = !pointing_device_driver->get_cpi ? 0 : pointing_device_driver->get_cpi(); // check for NULL
+    pointing_device_unlock();
 
     split_shared_memory_lock();
     split_slave_pointing_sync_t pointing;
@@ -761,10 +766,19 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     split_shared_memory_unlock();
 
     if (pointing.cpi && pointing.cpi != temp_cpi && pointing_device_driver->set_cpi) {
+        pointing_device_lock();
         pointing_device_driver->set_cpi(pointing.cpi);
+        pointing_device_unlock();
     }
 
+#    ifdef POINTING_DEVICE_ACCUMULATE_MOTION
+    // Changes to the buttons apply on top of the previously published report
+    pointing.report = pointing_device_get_accumulated_report(pointing.report);
+#    else
+    pointing_device_lock();
     pointing.report = pointing_device_driver->get_report((report_mouse_t){0});
+    pointing_device_unlock();
+#    endif
     // Now update the checksum given that the pointing has been written to
     pointing.checksum = crc8(&pointing.report, sizeof(report_mouse_t));
 
@@ -0,0 +1,152 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "ring_buffer.h"
+}
+
+RING_BUFFER_DEFINE(small_ring, uint32_t, 4);
+RING_BUFFER_DEFINE(byte_ring, uint8_t, 256);
+RING_BUFFER_DEFINE(stress_ring, uint32_t, 64);
+
+TEST(RingBuffer, PushPopInOrder) {
+    small_ring_t rb;
+    small_ring_clear(&rb);
+
+    EXPECT_TRUE(small_ring_empty(&rb));
+    EXPECT_TRUE(small_ring_push(&rb, 1));
+    EXPECT_TRUE(small_ring_push(&rb, 2));
+    EXPECT_TRUE(small_ring_push(&rb, 3));
+    EXPECT_TRUE(small_ring_full(&rb));
+    EXPECT_FALSE(small_ring_push(&rb, 4));
+    EXPECT_EQ(small_ring_count(&rb), 3);
+
+    uint32_t value;
+    for (uint32_t expected = 1; expected <= 3; expected++) {
+        EXPECT_TRUE(small_ring_pop(&rb, &value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(small_ring_pop(&rb, &value));
+    EXPECT_TRUE(small_ring_empty(&rb));
+}
+
+TEST(RingBuffer, BulkWrapsAround) {
+    small_ring_t rb;
+    small_ring_clear(&rb);
+
+    uint32_t in[]  = {1, 2, 3, 4, 5};
+    uint32_t out[] = {0, 0, 0, 0, 0};
+
+    // Move the indices close to the end of the buffer first
+    EXPECT_EQ(small_ring_push_bulk(&rb, in, 2), 2);
+    EXPECT_EQ(small_ring_pop_bulk(&rb, out, 2), 2);
+
+    EXPECT_EQ(small_ring_push_bulk(&rb, in, 5), 3);
+    EXPECT_EQ(small_ring_push_bulk(&rb, in, 1), 0);
+    EXPECT_EQ(small_ring_pop_bulk(&rb, out, 5), 3);
+    EXPECT_EQ(out[0], 1);
+    EXPECT_EQ(out[1], 2);
+    EXPECT_EQ(out[2], 3);
+    EXPECT_EQ(small_ring_pop_bulk(&rb, out, 5), 0);
+}
+
+TEST(RingBuffer, Drain) {
+    small_ring_t rb;
+    small_ring_clear(&rb);
+
+    small_ring_push(&rb, 1);
+    small_ring_push(&rb, 2);
+    small_ring_drain(&rb);
+    EXPECT_TRUE(small_ring_empty(&rb));
+    EXPECT_TRUE(small_ring_push(&rb, 3));
+    EXPECT_EQ(small_ring_count(&rb), 1);
+}
+
+TEST(RingBuffer, FullSizeByteIndices) {
+    byte_ring_t rb;
+    byte_ring_clear(&rb);
+
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 255; i++) {
+            EXPECT_TRUE(byte_ring_push(&rb, i));
+        }
+        EXPECT_FALSE(byte_ring_push(&rb, 0));
+        EXPECT_EQ(byte_ring_count(&rb), 255);
+
+        uint8_t value;
+        for (int i = 0; i < 200; i++) {
+            EXPECT_TRUE(byte_ring_pop(&rb, &value));
+            EXPECT_EQ(value, i);
+        }
+        EXPECT_EQ(byte_ring_count(&rb), 55);
+        for (int i = 200; i < 255; i++) {
+            EXPECT_TRUE(byte_ring_pop(&rb, &value));
+            EXPECT_EQ(value, i);
+        }
+        EXPECT_TRUE(byte_ring_empty(&rb));
+    }
+}
+
+// One thread pushes an increasing sequence while another pops it, mixing single
+// and bulk operations of varying sizes. Any lost, duplicated or torn element
+// breaks the sequence.
+TEST(RingBuffer, ThreadedStress) {
+    static stress_ring_t rb;
+    stress_ring_clear(&rb);
+
+    const uint32_t total = 2000000;
+
+    std::thread producer([&] {
+        uint32_t next = 0;
+        uint32_t batch[16];
+        while (next < total) {
+            uint8_t size = (next % 17);
+            uint8_t count;
+            if (size == 0) {
+                count = stress_ring_push(&rb, next) ? 1 : 0;
+            } else {
+                for (uint8_t i = 0; i < size; i++) {
+                    batch[i] = next + i;
+                }
+                if (size > total - next) {
+                    size = total - next;
+                }
+                count = stress_ring_push_bulk(&rb, batch, size);
+            }
+            if (count == 0) {
+                // Let the consumer run, in case both threads share a core
+                std::this_thread::yield();
+            }
+            next += count;
+        }
+    });
+
+    uint32_t expected = 0;
+    uint32_t errors   = 0;
+    uint32_t batch[16];
+    while (expected < total) {
+        uint8_t size = (expected % 13) + 1;
+        uint8_t count;
+        if (size == 1) {
+            count = stress_ring_pop(&rb, batch) ? 1 : 0;
+        } else {
+            count = stress_ring_pop_bulk(&rb, batch, size);
+        }
+        if (count == 0) {
+            std::this_thread::yield();
+        }
+        for (uint8_t i = 0; i < count; i++) {
+            if (batch[i] != expected++) {
+                errors++;
+            }
+        }
+    }
+
+    producer.join();
+    EXPECT_EQ(errors, 0);
+    EXPECT_TRUE(stress_ring_empty(&rb));
+}
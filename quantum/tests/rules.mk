@@ -0,0 +1,4 @@
+ring_buffer_DEFS := -DNO_DEBUG
+
+ring_buffer_SRC := \
+    $(QUANTUM_PATH)/tests/ring_buffer_tests.cpp
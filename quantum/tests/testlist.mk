@@ -0,0 +1 @@
+TEST_LIST += ring_buffer
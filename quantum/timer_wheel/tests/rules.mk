@@ -0,0 +1,8 @@
+timer_wheel_SRC := \
+    $(QUANTUM_PATH)/timer_wheel/tests/timer_wheel_tests.cpp \
+    $(QUANTUM_PATH)/timer_wheel/timer_wheel.c \
+    $(PLATFORM_PATH)/timer.c \
+    $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+timer_wheel_INC := \
+    $(QUANTUM_PATH)/timer_wheel
@@ -0,0 +1 @@
+TEST_LIST += timer_wheel
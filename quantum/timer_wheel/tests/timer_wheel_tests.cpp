@@ -0,0 +1,143 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "timer_wheel.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+static std::vector<uint32_t> fired_a;
+static std::vector<uint32_t> fired_b;
+static uint32_t              repeat_interval = 0;
+
+static timer_wheel_timer_t timer_a;
+static timer_wheel_timer_t timer_b;
+
+static void callback_a(void) {
+    fired_a.push_back(timer_read32());
+    if (repeat_interval > 0) {
+        timer_wheel_schedule(&timer_a, repeat_interval);
+    }
+}
+
+static void callback_b(void) {
+    fired_b.push_back(timer_read32());
+}
+
+class TimerWheelTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        timer_a = (timer_wheel_timer_t)TIMER_WHEEL_TIMER(callback_a);
+        timer_b = (timer_wheel_timer_t)TIMER_WHEEL_TIMER(callback_b);
+        fired_a.clear();
+        fired_b.clear();
+        repeat_interval = 0;
+    }
+
+    void TearDown() override {
+        timer_wheel_cancel(&timer_a);
+        timer_wheel_cancel(&timer_b);
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; ++i) {
+            advance_time(1);
+            timer_wheel_task();
+        }
+    }
+};
+
+TEST_F(TimerWheelTest, FiresOnDeadline) {
+    timer_wheel_schedule(&timer_a, 5);
+    EXPECT_TRUE(timer_wheel_is_scheduled(&timer_a));
+    run_for(10);
+    EXPECT_EQ(fired_a, std::vector<uint32_t>({5}));
+    EXPECT_FALSE(timer_wheel_is_scheduled(&timer_a));
+}
+
+TEST_F(TimerWheelTest, FiresOnDeadlineAcrossAllLevels) {
+    const uint32_t delays[] = {1, 15, 16, 17, 255, 256, 257, 4095, 4096, 4097, 70000};
+    for (uint32_t delay : delays) {
+        fired_a.clear();
+        uint32_t start = timer_read32();
+        timer_wheel_schedule(&timer_a, delay);
+        run_for(delay + 2);
+        EXPECT_EQ(fired_a, std::vector<uint32_t>({start + delay})) << "delay " << delay;
+    }
+}
+
+TEST_F(TimerWheelTest, FiresOnDeadlineFromUnalignedStart) {
+    set_time(0xFFFFFF00 + 7);
+    timer_wheel_schedule(&timer_a, 300);
+    timer_wheel_schedule(&timer_b, 9);
+    run_for(400);
+    EXPECT_EQ(fired_a, std::vector<uint32_t>({(uint32_t)(0xFFFFFF00 + 7 + 300)}));
+    EXPECT_EQ(fired_b, std::vector<uint32_t>({0xFFFFFF00 + 7 + 9}));
+}
+
+TEST_F(TimerWheelTest, RescheduleReplacesDeadline) {
+    timer_wheel_schedule(&timer_a, 50);
+    run_for(40);
+    timer_wheel_schedule(&timer_a, 50);
+    run_for(100);
+    EXPECT_EQ(fired_a, std::vector<uint32_t>({90}));
+}
+
+TEST_F(TimerWheelTest, CancelPreventsFiring) {
+    timer_wheel_schedule(&timer_a, 20);
+    timer_wheel_schedule(&timer_b, 20);
+    timer_wheel_cancel(&timer_a);
+    EXPECT_FALSE(timer_wheel_is_scheduled(&timer_a));
+    run_for(30);
+    EXPECT_TRUE(fired_a.empty());
+    EXPECT_EQ(fired_b, std::vector<uint32_t>({20}));
+}
+
+TEST_F(TimerWheelTest, CatchesUpAfterLongLoopIteration) {
+    timer_wheel_schedule(&timer_a, 10);
+    timer_wheel_schedule(&timer_b, 30);
+    advance_time(100);
+    timer_wheel_task();
+    EXPECT_EQ(fired_a.size(), 1);
+    EXPECT_EQ(fired_b.size(), 1);
+}
+
+TEST_F(TimerWheelTest, CallbackCanReschedule) {
+    repeat_interval = 10;
+    timer_wheel_schedule(&timer_a, 10);
+    run_for(35);
+    EXPECT_EQ(fired_a, std::vector<uint32_t>({10, 20, 30}));
+}
+
+TEST_F(TimerWheelTest, NextDeadlineIsLowerBound) {
+    uint32_t deadline;
+    EXPECT_FALSE(timer_wheel_next_deadline(&deadline));
+
+    timer_wheel_schedule(&timer_a, 3);
+    ASSERT_TRUE(timer_wheel_next_deadline(&deadline));
+    EXPECT_EQ(deadline, 3);
+
+    timer_wheel_cancel(&timer_a);
+    timer_wheel_schedule(&timer_b, 1000);
+    ASSERT_TRUE(timer_wheel_next_deadline(&deadline));
+    EXPECT_LE(deadline, 1000);
+    EXPECT_GT(deadline, 0);
+}
+
+TEST_F(TimerWheelTest, SurvivesTimeGoingBackwards) {
+    timer_wheel_schedule(&timer_b, 5000);
+    run_for(100);
+    set_time(0);
+    timer_wheel_schedule(&timer_a, 20);
+    run_for(30);
+    EXPECT_EQ(fired_a, std::vector<uint32_t>({20}));
+    EXPECT_TRUE(fired_b.empty());
+}
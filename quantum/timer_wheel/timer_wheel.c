@@ -0,0 +1,211 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * Hierarchical timer wheel for feature timeouts.
+ *
+ * Level 0 has one slot per millisecond, and each slot of a higher level spans
+ * a full revolution of the level below it. Timers further out than the top
+ * level can reach wait on an overflow list. Whenever a level completes a
+ * revolution, the next slot of the level above is redistributed ("cascaded")
+ * into the lower levels, so scheduling and cancelling are O(1) and the main
+ * loop only ever looks at the level 0 slot of the current millisecond.
+ */
+
+#include <stddef.h>
+#include "timer.h"
+#include "timer_wheel.h"
+
+#ifndef TIMER_WHEEL_SLOT_BITS
+#    define TIMER_WHEEL_SLOT_BITS 4
+#endif
+
+#define TIMER_WHEEL_LEVELS 3
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_SLOT_BITS)
+#define TIMER_WHEEL_SLOT_MASK (TIMER_WHEEL_SLOTS - 1)
+// Number of milliseconds represented by one slot of the given level
+#define LEVEL_SHIFT(level) ((level) * TIMER_WHEEL_SLOT_BITS)
+// Number of milliseconds covered by a full revolution of the given level
+#define LEVEL_RANGE(level) ((uint32_t)1 << LEVEL_SHIFT((level) + 1))
+
+static timer_wheel_timer_t *wheel[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS] = {0};
+static timer_wheel_timer_t *overflow                                      = NULL;
+static uint32_t             wheel_time                                    = 0; // next millisecond to be processed
+static uint16_t             pending_count                                 = 0;
+
+//------------------------------------
+// Helpers
+//
+
+static void list_add(timer_wheel_timer_t **head, timer_wheel_timer_t *timer) {
+    timer->next = *head;
+    if (timer->next) {
+        timer->next->pprev = &timer->next;
+    }
+    timer->pprev = head;
+    *head        = timer;
+}
+
+static void list_del(timer_wheel_timer_t *timer) {
+    *timer->pprev = timer->next;
+    if (timer->next) {
+        timer->next->pprev = timer->pprev;
+    }
+    timer->next  = NULL;
+    timer->pprev = NULL;
+}
+
+static void insert(timer_wheel_timer_t *timer) {
+    int32_t delta = (int32_t)TIMER_DIFF_32(timer->deadline, wheel_time);
+    if (delta < 0) {
+        // Already due, run it on the next processed millisecond
+        timer->deadline = wheel_time;
+        delta           = 0;
+    }
+
+    for (uint8_t level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+        if ((uint32_t)delta < LEVEL_RANGE(level)) {
+            list_add(&wheel[level][(timer->deadline >> LEVEL_SHIFT(level)) & TIMER_WHEEL_SLOT_MASK], timer);
+            return;
+        }
+    }
+    list_add(&overflow, timer);
+}
+
+static void cascade(timer_wheel_timer_t **head) {
+    timer_wheel_timer_t *timer = *head;
+    *head                      = NULL;
+    while (timer) {
+        timer_wheel_timer_t *next = timer->next;
+        insert(timer);
+        timer = next;
+    }
+}
+
+static void move_all(timer_wheel_timer_t **from, timer_wheel_timer_t **to) {
+    while (*from) {
+        timer_wheel_timer_t *timer = *from;
+        list_del(timer);
+        list_add(to, timer);
+    }
+}
+
+static void sync_time(uint32_t now) {
+    if (pending_count == 0) {
+        // Nothing to keep in order, so skip straight to the present
+        wheel_time = now;
+    } else if ((int32_t)TIMER_DIFF_32(now, wheel_time) < 0) {
+        // The timer went backwards (only expected on the test platform), so re-file everything relative to now
+        timer_wheel_timer_t *all = NULL;
+        for (uint8_t level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+            for (uint8_t slot = 0; slot < TIMER_WHEEL_SLOTS; ++slot) {
+                move_all(&wheel[level][slot], &all);
+            }
+        }
+        move_all(&overflow, &all);
+        wheel_time = now;
+        cascade(&all);
+    }
+}
+
+static void process_one_ms(void) {
+    if ((wheel_time & (LEVEL_RANGE(TIMER_WHEEL_LEVELS - 1) - 1)) == 0) {
+        cascade(&overflow);
+    }
+    for (uint8_t level = TIMER_WHEEL_LEVELS - 1; level > 0; --level) {
+        if ((wheel_time & (LEVEL_RANGE(level - 1) - 1)) == 0) {
+            cascade(&wheel[level][(wheel_time >> LEVEL_SHIFT(level)) & TIMER_WHEEL_SLOT_MASK]);
+        }
+    }
+
+    // Detach the expired timers before invoking anything, so callbacks are free to schedule or cancel any timer
+    timer_wheel_timer_t **slot    = &wheel[0][wheel_time & TIMER_WHEEL_SLOT_MASK];
+    timer_wheel_timer_t * expired = *slot;
+    *slot                         = NULL;
+    if (expired) {
+        expired->pprev = &expired;
+    }
+    ++wheel_time;
+
+    while (expired) {
+        timer_wheel_timer_t *timer = expired;
+        list_del(timer);
+        --pending_count;
+        timer->callback();
+    }
+}
+
+//------------------------------------
+// API
+//
+
+void timer_wheel_schedule(timer_wheel_timer_t *timer, uint32_t delay_ms) {
+    uint32_t now = timer_read32();
+    sync_time(now);
+
+    if (timer_wheel_is_scheduled(timer)) {
+        list_del(timer);
+    } else {
+        ++pending_count;
+    }
+    timer->deadline = now + delay_ms;
+    insert(timer);
+}
+
+void timer_wheel_cancel(timer_wheel_timer_t *timer) {
+    if (timer_wheel_is_scheduled(timer)) {
+        list_del(timer);
+        --pending_count;
+    }
+}
+
+bool timer_wheel_is_scheduled(const timer_wheel_timer_t *timer) {
+    return timer->pprev != NULL;
+}
+
+bool timer_wheel_next_deadline(uint32_t *deadline) {
+    if (pending_count == 0) {
+        return false;
+    }
+
+    // Level 0 slots hold exact deadlines, higher levels are bounded by the start of the slot's span
+    uint32_t earliest = UINT32_MAX;
+    for (uint8_t i = 0; i < TIMER_WHEEL_SLOTS; ++i) {
+        if (wheel[0][(wheel_time + i) & TIMER_WHEEL_SLOT_MASK]) {
+            earliest = i;
+            break;
+        }
+    }
+    for (uint8_t level = 1; level < TIMER_WHEEL_LEVELS; ++level) {
+        // The slot of the current span is only still pending if it hasn't been cascaded yet, i.e. at its very start
+        uint32_t base  = wheel_time >> LEVEL_SHIFT(level);
+        uint8_t  first = (wheel_time & (LEVEL_RANGE(level - 1) - 1)) == 0 ? 0 : 1;
+        for (uint8_t i = first; i < first + TIMER_WHEEL_SLOTS; ++i) {
+            if (wheel[level][(base + i) & TIMER_WHEEL_SLOT_MASK]) {
+                uint32_t delta = ((base + i) << LEVEL_SHIFT(level)) - wheel_time;
+                if (delta < earliest) {
+                    earliest = delta;
+                }
+                break;
+            }
+        }
+    }
+    for (timer_wheel_timer_t *timer = overflow; timer; timer = timer->next) {
+        uint32_t delta = timer->deadline - wheel_time;
+        if (delta < earliest) {
+            earliest = delta;
+        }
+    }
+
+    *deadline = wheel_time + earliest;
+    return true;
+}
+
+void timer_wheel_task(void) {
+    uint32_t now = timer_read32();
+    sync_time(now);
+
+    while (pending_count > 0 && (int32_t)TIMER_DIFF_32(now, wheel_time) >= 0) {
+        process_one_ms();
+    }
+}
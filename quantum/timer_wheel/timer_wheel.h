@@ -0,0 +1,65 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @typedef Callback invoked from the main loop once a timer's deadline has been reached.
+ */
+typedef void (*timer_wheel_callback_t)(void);
+
+/**
+ * @struct A timer that can be placed on the timer wheel.
+ * @brief Storage is owned by the caller, typically as a static variable next to the feature state it times out.
+ *        Code outside timer_wheel.c should only initialise it with TIMER_WHEEL_TIMER() and not touch its internals.
+ */
+typedef struct timer_wheel_timer_t {
+    struct timer_wheel_timer_t * next;
+    struct timer_wheel_timer_t **pprev;
+    uint32_t                     deadline;
+    timer_wheel_callback_t       callback;
+} timer_wheel_timer_t;
+
+/**
+ * @def Static initialiser for a timer that invokes the given callback on expiry.
+ */
+#define TIMER_WHEEL_TIMER(cb) \
+    { .next = NULL, .pprev = NULL, .deadline = 0, .callback = (cb) }
+
+/**
+ * Schedules the timer to expire after the required number of milliseconds, rescheduling it if it is already pending.
+ *
+ * @param timer[in] the timer to schedule
+ * @param delay_ms[in] the number of milliseconds before invoking the timer's callback
+ */
+void timer_wheel_schedule(timer_wheel_timer_t *timer, uint32_t delay_ms);
+
+/**
+ * Removes the timer from the wheel without invoking its callback. Does nothing if it isn't pending.
+ *
+ * @param timer[in] the timer to cancel
+ */
+void timer_wheel_cancel(timer_wheel_timer_t *timer);
+
+/**
+ * @param timer[in] the timer to query
+ * @return true if the timer is waiting to expire
+ */
+bool timer_wheel_is_scheduled(const timer_wheel_timer_t *timer);
+
+/**
+ * Retrieves a lower bound of the earliest pending deadline, for use when deciding how long the MCU may sleep.
+ *
+ * @param deadline[out] the earliest time a pending timer may expire -- equivalent time-space as timer_read32()
+ * @return false if no timers are pending
+ */
+bool timer_wheel_next_deadline(uint32_t *deadline);
+
+/**
+ * Dispatches all timers whose deadline has been reached. Should not be invoked by keyboard/user code.
+ */
+void timer_wheel_task(void);
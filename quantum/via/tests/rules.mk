@@ -0,0 +1,8 @@
+via_bulk_DEFS := -DVIA_BULK_ENABLE -DEEPROM_TEST_HARNESS
+
+via_bulk_SRC := \
+    $(QUANTUM_PATH)/via/tests/via_bulk_tests.cpp \
+    $(QUANTUM_PATH)/via/via_bulk.c
+
+via_bulk_INC := \
+    $(QUANTUM_PATH)/via
@@ -0,0 +1,330 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "via_bulk.h"
+}
+
+#define PACKET_SIZE 32
+#define HEADER_SIZE 3
+
+typedef std::vector<uint8_t> bytes_t;
+
+static bytes_t              keymap(300);
+static bytes_t              macros(64);
+static std::vector<bytes_t> sent;
+static int                  transactions;
+
+static void buffer_get(const bytes_t &buffer, uint16_t offset, uint16_t size, uint8_t *data) {
+    for (uint16_t i = 0; i < size; i++) {
+        data[i] = offset + i < buffer.size() ? buffer[offset + i] : 0x00;
+    }
+}
+
+static void buffer_set(bytes_t &buffer, uint16_t offset, uint16_t size, uint8_t *data) {
+    for (uint16_t i = 0; i < size; i++) {
+        if (offset + i < buffer.size()) {
+            buffer[offset + i] = data[i];
+        }
+    }
+}
+
+extern "C" {
+void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    buffer_get(keymap, offset, size, data);
+}
+
+void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    buffer_set(keymap, offset, size, data);
+}
+
+void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    buffer_get(macros, offset, size, data);
+}
+
+void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    buffer_set(macros, offset, size, data);
+}
+
+void eeconfig_transaction_begin(void) {
+    transactions++;
+}
+
+void eeconfig_transaction_commit(void) {}
+
+void raw_hid_send(uint8_t *data, uint8_t length) {
+    sent.emplace_back(data, data + length);
+}
+}
+
+// Host side of the run-length code
+static bytes_t rle_decode(const bytes_t &coded, size_t unit) {
+    bytes_t decoded;
+    for (size_t i = 0; i < coded.size();) {
+        uint8_t token = coded[i++];
+        if (token & 0x80) {
+            for (int n = 0; n < (token & 0x7F) + 2; n++) {
+                decoded.insert(decoded.end(), coded.begin() + i, coded.begin() + i + unit);
+            }
+            i += unit;
+        } else {
+            decoded.insert(decoded.end(), coded.begin() + i, coded.begin() + i + (token + 1) * unit);
+            i += (token + 1) * unit;
+        }
+    }
+    return decoded;
+}
+
+static bytes_t rle_encode(const bytes_t &data, size_t unit) {
+    bytes_t coded;
+    size_t  units = data.size() / unit;
+    auto    equal = [&](size_t a, size_t b) { return std::memcmp(&data[a * unit], &data[b * unit], unit) == 0; };
+    for (size_t i = 0; i < units;) {
+        size_t run = 1;
+        while (i + run < units && run < VIA_BULK_RLE_MAX_RUN && equal(i, i + run)) {
+            run++;
+        }
+        if (run > 1) {
+            coded.push_back(0x80 | (run - 2));
+            coded.insert(coded.end(), data.begin() + i * unit, data.begin() + (i + 1) * unit);
+            i += run;
+            continue;
+        }
+        size_t literal = 1;
+        while (i + literal < units && literal < VIA_BULK_RLE_MAX_LITERAL && !(i + literal + 1 < units && equal(i + literal, i + literal + 1))) {
+            literal++;
+        }
+        coded.push_back(literal - 1);
+        coded.insert(coded.end(), data.begin() + i * unit, data.begin() + (i + literal) * unit);
+        i += literal;
+    }
+    return coded;
+}
+
+class ViaBulkTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        std::fill(keymap.begin(), keymap.end(), 0);
+        std::fill(macros.begin(), macros.end(), 0);
+        // Abandon any transfer left over by a previous test
+        command({id_bulk_set_buffer, id_bulk_region_keymap, 0, 0, 0, 0, 0, 0});
+        sent.clear();
+        transactions = 0;
+    }
+
+    bool command(bytes_t request) {
+        request.resize(PACKET_SIZE);
+        return via_bulk_command(request.data(), request.size());
+    }
+
+    bytes_t read(uint8_t region, uint16_t offset, uint16_t size, uint8_t flags) {
+        sent.clear();
+        EXPECT_TRUE(command({id_bulk_get_buffer, region, (uint8_t)(offset >> 8), (uint8_t)offset, (uint8_t)(size >> 8), (uint8_t)size, flags}));
+
+        bytes_t payload;
+        for (size_t i = 0; i < sent.size(); i++) {
+            EXPECT_EQ(sent[i][0], id_bulk_get_buffer);
+            EXPECT_EQ(sent[i][1], i);
+            EXPECT_LE(sent[i][2], PACKET_SIZE - HEADER_SIZE);
+            payload.insert(payload.end(), sent[i].begin() + HEADER_SIZE, sent[i].begin() + HEADER_SIZE + sent[i][2]);
+        }
+        return payload;
+    }
+
+    void start_write(uint8_t region, uint16_t offset, uint16_t size, uint8_t flags, uint8_t window) {
+        sent.clear();
+        EXPECT_TRUE(command({id_bulk_set_buffer, region, (uint8_t)(offset >> 8), (uint8_t)offset, (uint8_t)(size >> 8), (uint8_t)size, flags, window}));
+        ASSERT_EQ(sent.size(), 1U);
+        EXPECT_EQ(sent[0][0], id_bulk_set_buffer);
+        sent.clear();
+    }
+
+    void send_data(uint8_t seq, const bytes_t &payload) {
+        bytes_t packet = {id_bulk_set_buffer_data, seq, (uint8_t)payload.size()};
+        packet.insert(packet.end(), payload.begin(), payload.end());
+        EXPECT_TRUE(command(packet));
+    }
+
+    // Sends a whole payload, returning the acknowledgements received
+    std::vector<bytes_t> write_payload(const bytes_t &payload) {
+        uint8_t seq = 0;
+        for (size_t i = 0; i < payload.size(); i += PACKET_SIZE - HEADER_SIZE) {
+            size_t end = std::min(payload.size(), i + PACKET_SIZE - HEADER_SIZE);
+            send_data(seq++, bytes_t(payload.begin() + i, payload.begin() + end));
+        }
+        return sent;
+    }
+};
+
+TEST_F(ViaBulkTest, UnknownRegionIsNotHandled) {
+    EXPECT_FALSE(command({id_bulk_get_buffer, 0x7F, 0, 0, 0, 16, 0}));
+    EXPECT_FALSE(command({id_bulk_set_buffer, 0x7F, 0, 0, 0, 16, 0, 1}));
+    EXPECT_FALSE(command({0x01}));
+    EXPECT_TRUE(sent.empty());
+}
+
+TEST_F(ViaBulkTest, ReadStreamsWholeBuffer) {
+    for (size_t i = 0; i < keymap.size(); i++) {
+        keymap[i] = i * 7;
+    }
+
+    bytes_t payload = read(id_bulk_region_keymap, 10, 200, 0);
+    EXPECT_EQ(sent.size(), (200U + 28) / 29);
+    EXPECT_EQ(payload, bytes_t(keymap.begin() + 10, keymap.begin() + 210));
+}
+
+TEST_F(ViaBulkTest, ReadPadsPastTheEndOfTheBuffer) {
+    std::fill(macros.begin(), macros.end(), 0xAA);
+
+    bytes_t payload = read(id_bulk_region_macro, 60, 8, 0);
+    EXPECT_EQ(payload, bytes_t({0xAA, 0xAA, 0xAA, 0xAA, 0, 0, 0, 0}));
+}
+
+TEST_F(ViaBulkTest, EmptyReadStillReplies) {
+    EXPECT_TRUE(read(id_bulk_region_keymap, 0, 0, VIA_BULK_FLAG_RLE).empty());
+    EXPECT_EQ(sent.size(), 1U);
+}
+
+TEST_F(ViaBulkTest, LargeReadIsCutShort) {
+    for (size_t i = 0; i < keymap.size(); i++) {
+        keymap[i] = i * 7;
+    }
+
+    bytes_t payload = read(id_bulk_region_keymap, 0, 0xFFFF, 0);
+    EXPECT_EQ(payload.size(), VIA_BULK_GET_MAX_SIZE);
+    EXPECT_EQ(bytes_t(payload.begin(), payload.begin() + keymap.size()), keymap);
+
+    // The host carries on from where the payload ended
+    EXPECT_EQ(read(id_bulk_region_keymap, VIA_BULK_GET_MAX_SIZE, 0xFFFF, VIA_BULK_FLAG_RLE), rle_encode(bytes_t(VIA_BULK_GET_MAX_SIZE), 2));
+}
+
+TEST_F(ViaBulkTest, CodedReadOfSparseKeymapFitsOnePacket) {
+    // Mostly KC_TRNS, with a few keys set
+    for (size_t i = 0; i < keymap.size(); i += 2) {
+        keymap[i + 1] = 0x01;
+    }
+    keymap[40]  = 0x00;
+    keymap[41]  = 0x04;
+    keymap[42]  = 0x00;
+    keymap[43]  = 0x05;
+    keymap[200] = 0x7C;
+
+    bytes_t payload = read(id_bulk_region_keymap, 0, keymap.size(), VIA_BULK_FLAG_RLE);
+    EXPECT_EQ(sent.size(), 1U);
+    EXPECT_EQ(rle_decode(payload, 2), keymap);
+    EXPECT_EQ(payload, rle_encode(keymap, 2));
+}
+
+TEST_F(ViaBulkTest, CodedReadMatchesHostEncoder) {
+    std::mt19937 rng(47);
+    for (int round = 0; round < 50; round++) {
+        // Random runs and noise, so that tokens straddle packets and hit both length limits
+        for (size_t i = 0; i < keymap.size();) {
+            size_t  length = rng() % 3 == 0 ? rng() % 300 : 1 + rng() % 3;
+            bool    noise  = rng() % 2;
+            uint8_t value  = rng() % 4;
+            for (size_t j = 0; j < length && i < keymap.size(); j++, i++) {
+                keymap[i] = noise ? rng() : value;
+            }
+        }
+        uint16_t offset = rng() % 50;
+        uint16_t size   = rng() % (keymap.size() - offset);
+        size_t   unit   = size % 2 == 0 ? 2 : 1;
+        bytes_t  source(keymap.begin() + offset, keymap.begin() + offset + size);
+
+        bytes_t payload = read(id_bulk_region_keymap, offset, size, VIA_BULK_FLAG_RLE);
+        EXPECT_EQ(payload, rle_encode(source, unit)) << "round " << round;
+        EXPECT_EQ(rle_decode(payload, unit), source) << "round " << round;
+    }
+}
+
+TEST_F(ViaBulkTest, WindowedWriteAcknowledgesEachWindow) {
+    bytes_t source(200);
+    for (size_t i = 0; i < source.size(); i++) {
+        source[i] = i ^ 0x5A;
+    }
+
+    start_write(id_bulk_region_keymap, 20, source.size(), 0, 3);
+    auto acks = write_payload(source);
+
+    // 7 packets: acknowledged after the 3rd, the 6th and the last one
+    ASSERT_EQ(acks.size(), 3U);
+    EXPECT_EQ(acks[0][1], via_bulk_in_progress);
+    EXPECT_EQ(acks[0][2], 3);
+    EXPECT_EQ((acks[0][3] << 8) | acks[0][4], 3 * 29);
+    EXPECT_EQ(acks[1][2], 6);
+    EXPECT_EQ(acks[2][1], via_bulk_complete);
+    EXPECT_EQ(acks[2][2], 7);
+    EXPECT_EQ((acks[2][3] << 8) | acks[2][4], 200);
+    EXPECT_EQ(bytes_t(keymap.begin() + 20, keymap.begin() + 220), source);
+    EXPECT_EQ(keymap[19], 0);
+    EXPECT_EQ(keymap[220], 0);
+}
+
+TEST_F(ViaBulkTest, CodedWriteRoundTrips) {
+    bytes_t source(keymap.size());
+    for (size_t i = 0; i < source.size(); i += 2) {
+        source[i + 1] = i % 40 == 0 ? i / 2 : 0x01;
+    }
+
+    bytes_t payload = rle_encode(source, 2);
+    ASSERT_LT(payload.size(), 2U * 29);
+
+    start_write(id_bulk_region_keymap, 0, source.size(), VIA_BULK_FLAG_RLE, 8);
+    auto acks = write_payload(payload);
+
+    ASSERT_EQ(acks.size(), 1U);
+    EXPECT_EQ(acks[0][1], via_bulk_complete);
+    EXPECT_EQ(keymap, source);
+    EXPECT_EQ(transactions, (payload.size() + 28) / 29);
+}
+
+TEST_F(ViaBulkTest, CodedMacroWriteUsesByteUnits) {
+    bytes_t source = {'a', 'b', 0, 0, 0, 0, 0, 'c', 'c', 'c', 0};
+    source.resize(macros.size());
+
+    start_write(id_bulk_region_macro, 0, source.size(), VIA_BULK_FLAG_RLE, 1);
+    write_payload(rle_encode(source, 1));
+
+    EXPECT_EQ(macros, source);
+}
+
+TEST_F(ViaBulkTest, OutOfSequencePacketAbortsTransfer) {
+    start_write(id_bulk_region_macro, 0, 60, 0, 4);
+    send_data(0, bytes_t(29, 0x11));
+    send_data(2, bytes_t(29, 0x22));
+
+    ASSERT_EQ(sent.size(), 1U);
+    EXPECT_EQ(sent[0][1], via_bulk_error);
+    EXPECT_EQ(sent[0][2], 1);
+    EXPECT_EQ((sent[0][3] << 8) | sent[0][4], 29);
+
+    // The transfer has to be restarted from what was written
+    send_data(1, bytes_t(29, 0x22));
+    EXPECT_EQ(sent.back()[1], via_bulk_error);
+    EXPECT_EQ(macros[29], 0);
+}
+
+TEST_F(ViaBulkTest, DataBeyondTheTransferIsAnError) {
+    start_write(id_bulk_region_keymap, 0, 8, VIA_BULK_FLAG_RLE, 4);
+    // A run of 5 keycodes, when only 4 were announced
+    send_data(0, {0x83, 0x00, 0x04});
+
+    ASSERT_EQ(sent.size(), 1U);
+    EXPECT_EQ(sent[0][1], via_bulk_error);
+}
+
+TEST_F(ViaBulkTest, DataWithoutTransferIsAnError) {
+    send_data(0, {0x00, 0x01});
+
+    ASSERT_EQ(sent.size(), 1U);
+    EXPECT_EQ(sent[0][0], id_bulk_set_buffer_data);
+    EXPECT_EQ(sent[0][1], via_bulk_error);
+}
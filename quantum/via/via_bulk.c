@@ -0,0 +1,303 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "via_bulk.h"
+
+#include <string.h>
+#include "raw_hid.h"
+#include "dynamic_keymap.h"
+#include "eeconfig.h"
+#include "util.h"
+
+// Packets carry [ command_id, seq, payload_length, payload ]
+#define VIA_BULK_HEADER_SIZE 3
+
+// Reads that are cut short must not end half way into a keycode
+_Static_assert(VIA_BULK_GET_MAX_SIZE > 0 && VIA_BULK_GET_MAX_SIZE % 2 == 0, "VIA_BULK_GET_MAX_SIZE must be a positive even number");
+
+typedef struct {
+    void (*get)(uint16_t offset, uint16_t size, uint8_t *data);
+    void (*set)(uint16_t offset, uint16_t size, uint8_t *data);
+    uint8_t unit;
+} via_bulk_region_t;
+
+static const via_bulk_region_t via_bulk_regions[] = {
+    [id_bulk_region_keymap] = {dynamic_keymap_get_buffer, dynamic_keymap_set_buffer, 2},
+    [id_bulk_region_macro]  = {dynamic_keymap_macro_get_buffer, dynamic_keymap_macro_set_buffer, 1},
+};
+
+typedef struct {
+    uint8_t *data;
+    uint8_t  length;
+    uint8_t  count;
+    bool     sent;
+} via_bulk_packet_t;
+
+static struct {
+    const via_bulk_region_t *region;
+    uint16_t                 offset;
+    uint16_t                 remaining;
+    uint16_t                 written;
+    uint8_t                  flags;
+    uint8_t                  unit;
+    uint8_t                  window;
+    uint8_t                  received;
+    uint8_t                  seq;
+    bool                     active;
+    // Run-length decoder state
+    uint8_t token_units;
+    bool    token_run;
+    uint8_t unit_fill;
+    uint8_t unit_data[2];
+    // Decoded data not yet written
+    uint8_t out[32];
+    uint8_t out_count;
+} via_bulk_write;
+
+static const via_bulk_region_t *via_bulk_region(uint8_t region_id) {
+    return region_id < ARRAY_SIZE(via_bulk_regions) ? &via_bulk_regions[region_id] : NULL;
+}
+
+// Keycodes are only coded as a whole if the transfer doesn't end half way into one.
+static uint8_t via_bulk_unit(const via_bulk_region_t *region, uint16_t size) {
+    return (size % region->unit) == 0 ? region->unit : 1;
+}
+
+static void via_bulk_packet_flush(via_bulk_packet_t *packet) {
+    packet->data[2] = packet->count;
+    memset(&packet->data[VIA_BULK_HEADER_SIZE + packet->count], 0, packet->length - VIA_BULK_HEADER_SIZE - packet->count);
+    raw_hid_send(packet->data, packet->length);
+    packet->data[1]++;
+    packet->count = 0;
+    packet->sent  = true;
+}
+
+static void via_bulk_packet_put(via_bulk_packet_t *packet, const uint8_t *data, uint8_t size) {
+    for (uint8_t i = 0; i < size; i++) {
+        packet->data[VIA_BULK_HEADER_SIZE + packet->count++] = data[i];
+        if (VIA_BULK_HEADER_SIZE + packet->count == packet->length) {
+            via_bulk_packet_flush(packet);
+        }
+    }
+}
+
+static void via_bulk_encode(const via_bulk_region_t *region, uint16_t offset, uint16_t size, uint8_t unit, via_bulk_packet_t *packet) {
+    uint16_t units = size / unit;
+    uint8_t  current[2];
+    uint8_t  next[2] = {0};
+    uint8_t  token;
+
+    for (uint16_t i = 0; i < units;) {
+        region->get(offset + i * unit, unit, current);
+
+        uint16_t run = 1;
+        while (i + run < units && run < VIA_BULK_RLE_MAX_RUN) {
+            region->get(offset + (i + run) * unit, unit, next);
+            if (memcmp(current, next, unit) != 0) {
+                break;
+            }
+            run++;
+        }
+
+        if (run > 1) {
+            token = 0x80 | (run - 2);
+            via_bulk_packet_put(packet, &token, 1);
+            via_bulk_packet_put(packet, current, unit);
+            i += run;
+            continue;
+        }
+
+        // Copy units as they are up to the start of the next run. `next` holds
+        // the unit after the current one, as it ended the run above.
+        uint16_t literal = 1;
+        memcpy(current, next, unit);
+        while (i + literal < units && literal < VIA_BULK_RLE_MAX_LITERAL) {
+            if (i + literal + 1 < units) {
+                region->get(offset + (i + literal + 1) * unit, unit, next);
+                if (memcmp(current, next, unit) == 0) {
+                    break;
+                }
+                memcpy(current, next, unit);
+            }
+            literal++;
+        }
+
+        token = literal - 1;
+        via_bulk_packet_put(packet, &token, 1);
+        for (uint16_t j = 0; j < literal; j++) {
+            region->get(offset + (i + j) * unit, unit, current);
+            via_bulk_packet_put(packet, current, unit);
+        }
+        i += literal;
+    }
+}
+
+static bool via_bulk_get_buffer(uint8_t *data, uint8_t length) {
+    // data = [ command_id, region_id, offset_hi, offset_lo, size_hi, size_lo, flags ]
+    const via_bulk_region_t *region = via_bulk_region(data[1]);
+    if (region == NULL) {
+        return false;
+    }
+
+    uint16_t offset = (data[2] << 8) | data[3];
+    uint16_t size   = MIN((data[4] << 8) | data[5], VIA_BULK_GET_MAX_SIZE);
+    uint8_t  flags  = data[6];
+
+    // The response is streamed, reusing the request buffer for each packet
+    via_bulk_packet_t packet = {.data = data, .length = length};
+    data[1]                  = 0;
+
+    if (flags & VIA_BULK_FLAG_RLE) {
+        via_bulk_encode(region, offset, size, via_bulk_unit(region, size), &packet);
+    } else {
+        while (size > 0) {
+            uint8_t chunk = MIN(size, length - VIA_BULK_HEADER_SIZE - packet.count);
+            region->get(offset, chunk, &data[VIA_BULK_HEADER_SIZE + packet.count]);
+            packet.count += chunk;
+            offset += chunk;
+            size -= chunk;
+            if (VIA_BULK_HEADER_SIZE + packet.count == length) {
+                via_bulk_packet_flush(&packet);
+            }
+        }
+    }
+
+    if (packet.count > 0 || !packet.sent) {
+        via_bulk_packet_flush(&packet);
+    }
+    return true;
+}
+
+static bool via_bulk_set_buffer(uint8_t *data, uint8_t length) {
+    // data = [ command_id, region_id, offset_hi, offset_lo, size_hi, size_lo, flags, window ]
+    const via_bulk_region_t *region = via_bulk_region(data[1]);
+    if (region == NULL) {
+        return false;
+    }
+
+    uint16_t size = (data[4] << 8) | data[5];
+
+    memset(&via_bulk_write, 0, sizeof(via_bulk_write));
+    via_bulk_write.region    = region;
+    via_bulk_write.offset    = (data[2] << 8) | data[3];
+    via_bulk_write.remaining = size;
+    via_bulk_write.flags     = data[6];
+    via_bulk_write.unit      = via_bulk_unit(region, size);
+    via_bulk_write.window    = MAX(data[7], 1);
+    via_bulk_write.active    = size > 0;
+
+    raw_hid_send(data, length);
+    return true;
+}
+
+static void via_bulk_flush_output(void) {
+    if (via_bulk_write.out_count > 0) {
+        via_bulk_write.region->set(via_bulk_write.offset, via_bulk_write.out_count, via_bulk_write.out);
+        via_bulk_write.offset += via_bulk_write.out_count;
+        via_bulk_write.written += via_bulk_write.out_count;
+        via_bulk_write.out_count = 0;
+    }
+}
+
+static bool via_bulk_output(const uint8_t *data, uint8_t size) {
+    for (uint8_t i = 0; i < size; i++) {
+        if (via_bulk_write.remaining == 0) {
+            return false;
+        }
+        via_bulk_write.out[via_bulk_write.out_count++] = data[i];
+        via_bulk_write.remaining--;
+        if (via_bulk_write.out_count == sizeof(via_bulk_write.out)) {
+            via_bulk_flush_output();
+        }
+    }
+    return true;
+}
+
+static bool via_bulk_decode(uint8_t byte) {
+    if (!(via_bulk_write.flags & VIA_BULK_FLAG_RLE)) {
+        return via_bulk_output(&byte, 1);
+    }
+
+    if (via_bulk_write.token_units == 0) {
+        via_bulk_write.token_run   = byte & 0x80;
+        via_bulk_write.token_units = via_bulk_write.token_run ? (byte & 0x7F) + 2 : byte + 1;
+        via_bulk_write.unit_fill   = 0;
+        return true;
+    }
+
+    if (!via_bulk_write.token_run) {
+        if (++via_bulk_write.unit_fill == via_bulk_write.unit) {
+            via_bulk_write.unit_fill = 0;
+            via_bulk_write.token_units--;
+        }
+        return via_bulk_output(&byte, 1);
+    }
+
+    via_bulk_write.unit_data[via_bulk_write.unit_fill++] = byte;
+    if (via_bulk_write.unit_fill < via_bulk_write.unit) {
+        return true;
+    }
+    for (; via_bulk_write.token_units > 0; via_bulk_write.token_units--) {
+        if (!via_bulk_output(via_bulk_write.unit_data, via_bulk_write.unit)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void via_bulk_set_buffer_data(uint8_t *data, uint8_t length) {
+    // data = [ command_id, seq, payload_length, payload ]
+    uint8_t seq    = data[1];
+    uint8_t count  = data[2];
+    uint8_t status = via_bulk_in_progress;
+
+    if (!via_bulk_write.active || seq != via_bulk_write.seq || count > length - VIA_BULK_HEADER_SIZE) {
+        status = via_bulk_error;
+    } else {
+        bool ok = true;
+
+        eeconfig_transaction_begin();
+        for (uint8_t i = 0; i < count && ok; i++) {
+            ok = via_bulk_decode(data[VIA_BULK_HEADER_SIZE + i]);
+        }
+        via_bulk_flush_output();
+        eeconfig_transaction_commit();
+
+        via_bulk_write.seq++;
+        if (!ok) {
+            status = via_bulk_error;
+        } else if (via_bulk_write.remaining == 0) {
+            status = via_bulk_complete;
+        } else if (++via_bulk_write.received < via_bulk_write.window) {
+            // Only the last packet of each window is acknowledged
+            return;
+        }
+        via_bulk_write.received = 0;
+    }
+
+    if (status != via_bulk_in_progress) {
+        via_bulk_write.active = false;
+    }
+
+    // data = [ command_id, status, next_seq, written_hi, written_lo ]
+    memset(&data[1], 0, length - 1);
+    data[1] = status;
+    data[2] = via_bulk_write.seq;
+    data[3] = via_bulk_write.written >> 8;
+    data[4] = via_bulk_write.written & 0xFF;
+    raw_hid_send(data, length);
+}
+
+bool via_bulk_command(uint8_t *data, uint8_t length) {
+    switch (data[0]) {
+        case id_bulk_get_buffer:
+            return via_bulk_get_buffer(data, length);
+        case id_bulk_set_buffer:
+            return via_bulk_set_buffer(data, length);
+        case id_bulk_set_buffer_data:
+            via_bulk_set_buffer_data(data, length);
+            return true;
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,50 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Bulk transfers move a whole dynamic keymap or macro buffer in a few round trips,
+// instead of the 28 bytes per round trip of id_dynamic_keymap_get_buffer and friends.
+//
+// The command IDs lie outside of the range used by VIA, so that hosts can probe for
+// them: firmware without bulk transfer support replies with id_unhandled.
+enum via_bulk_command_id {
+    id_bulk_get_buffer      = 0x40,
+    id_bulk_set_buffer      = 0x41,
+    id_bulk_set_buffer_data = 0x42,
+};
+
+enum via_bulk_region_id {
+    id_bulk_region_keymap = 0x00,
+    id_bulk_region_macro  = 0x01,
+};
+
+enum via_bulk_status {
+    via_bulk_in_progress = 0x00,
+    via_bulk_complete    = 0x01,
+    via_bulk_error       = 0x02,
+};
+
+// Payloads are run-length coded when this flag is set.
+#define VIA_BULK_FLAG_RLE (1 << 0)
+
+// The run-length code is made of tokens, working on 1 byte units, or 2 byte units
+// (the keycodes) for keymap transfers of an even size:
+// - 0x00-0x7F: the next 1-128 units are copied as they are,
+// - 0x80-0xFF: the next unit is repeated 2-129 times.
+#define VIA_BULK_RLE_MAX_LITERAL 128
+#define VIA_BULK_RLE_MAX_RUN 129
+
+// Largest read answered by a single id_bulk_get_buffer, as all of its packets are
+// sent from within raw_hid_receive(). Larger reads are cut short, and the host
+// asks for the rest from where the payload ended.
+#ifndef VIA_BULK_GET_MAX_SIZE
+#    define VIA_BULK_GET_MAX_SIZE 512
+#endif
+
+// Handles the bulk transfer commands, returning true if the command was
+// fully handled, including calling raw_hid_send().
+bool via_bulk_command(uint8_t *data, uint8_t length);
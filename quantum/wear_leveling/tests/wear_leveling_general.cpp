@@ -202,3 +202,72 @@ TEST_F(WearLevelingGeneral, WriteFailure_NoSubsequentWrites) {
     wear_leveling_read(0x04, &test_val, sizeof(test_val));
     EXPECT_EQ(test_val, 0x14) << "Readback should come from cache regardless of unlock failure";
 }
+
+/**
+ * This test verifies that writes within a transaction are deferred until commit, and are then written as a single delimited unit.
+ */
+TEST_F(WearLevelingGeneral, Transaction_WritesDeferredUntilCommit) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint8_t test_val[2] = {0x11, 0x22};
+    EXPECT_EQ(wear_leveling_transaction_begin(), WEAR_LEVELING_SUCCESS) << "Transaction begin should have succeeded";
+    EXPECT_EQ(wear_leveling_write(0x01, &test_val[0], 1), WEAR_LEVELING_SUCCESS) << "Write within transaction should have succeeded";
+    EXPECT_EQ(wear_leveling_write(0x08, &test_val[1], 1), WEAR_LEVELING_SUCCESS) << "Write within transaction should have succeeded";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Write should not have been invoked before commit";
+
+    EXPECT_EQ(wear_leveling_transaction_commit(), WEAR_LEVELING_SUCCESS) << "Transaction commit should have succeeded";
+    EXPECT_EQ(inst.unlock_invoke_count(), 1) << "Unlock should have been invoked once";
+    EXPECT_EQ(inst.write_invoke_count(), 4) << "Write should have been invoked for the begin marker, two entries, and the end marker";
+    EXPECT_EQ(inst.lock_invoke_count(), 1) << "Lock should have been invoked once";
+
+    // Re-init and re-read, verifying the transaction is played back
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    uint8_t readback[WEAR_LEVELING_LOGICAL_SIZE];
+    EXPECT_EQ(wear_leveling_read(0, readback, sizeof(readback)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    for (int i = 0; i < WEAR_LEVELING_LOGICAL_SIZE; ++i) {
+        EXPECT_EQ(readback[i], i == 0x01 ? 0x11 : i == 0x08 ? 0x22 : 0x00) << "Invalid readback";
+    }
+}
+
+/**
+ * This test verifies that only the outermost commit of nested transactions writes to the backing store.
+ */
+TEST_F(WearLevelingGeneral, Transaction_NestedCommit) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint8_t test_val = 0x14;
+    EXPECT_EQ(wear_leveling_transaction_begin(), WEAR_LEVELING_SUCCESS) << "Transaction begin should have succeeded";
+    EXPECT_EQ(wear_leveling_transaction_begin(), WEAR_LEVELING_SUCCESS) << "Nested transaction begin should have succeeded";
+    EXPECT_EQ(wear_leveling_write(0x02, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write within transaction should have succeeded";
+    EXPECT_EQ(wear_leveling_transaction_commit(), WEAR_LEVELING_SUCCESS) << "Nested transaction commit should have succeeded";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Write should not have been invoked before the outermost commit";
+    EXPECT_EQ(wear_leveling_transaction_commit(), WEAR_LEVELING_SUCCESS) << "Transaction commit should have succeeded";
+    EXPECT_EQ(inst.write_invoke_count(), 3) << "Write should have been invoked for the begin marker, the entry, and the end marker";
+    EXPECT_EQ(wear_leveling_transaction_commit(), WEAR_LEVELING_FAILED) << "Unbalanced commit should have failed";
+}
+
+/**
+ * This test verifies that a transaction missing its end marker is discarded during playback.
+ */
+TEST_F(WearLevelingGeneral, Transaction_IncompleteDiscarded) {
+    auto& inst     = MockBackingStore::Instance();
+    auto  logstart = inst.storage_begin() + (WEAR_LEVELING_LOGICAL_SIZE / sizeof(backing_store_int_t));
+
+    // Set up a 1-byte logical write of [0x11] at logical offset 0x01, outside of any transaction
+    auto entry0 = LOG_ENTRY_MAKE_OPTIMIZED_64(0x01, 0x11);
+    (logstart + 4)->set(~entry0.raw16[0]);
+
+    // Set up a transaction containing a 1-byte logical write of [0x22] at logical offset 0x02, interrupted before the end marker
+    auto entry1 = LOG_ENTRY_MAKE_TRANSACTION(true);
+    auto entry2 = LOG_ENTRY_MAKE_OPTIMIZED_64(0x02, 0x22);
+    (logstart + 5)->set(~entry1.raw16[0]);
+    (logstart + 6)->set(~entry2.raw16[0]);
+
+    // Re-init
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_CONSOLIDATED) << "Init returned incorrect status";
+    uint8_t readback[WEAR_LEVELING_LOGICAL_SIZE];
+    EXPECT_EQ(wear_leveling_read(0, readback, sizeof(readback)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    for (int i = 0; i < WEAR_LEVELING_LOGICAL_SIZE; ++i) {
+        EXPECT_EQ(readback[i], i == 0x01 ? 0x11 : 0x00) << "Invalid readback";
+    }
+}
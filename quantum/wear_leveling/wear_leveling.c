@@ -153,7 +153,31 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Transactions:
+
+        Writes made between wear_leveling_transaction_begin() and
+        wear_leveling_transaction_commit() only update the cache. On commit, the
+        modified ranges are appended to the write log between a pair of
+        transaction markers, each occupying a single backing store write:
+
+        ╔ Transaction Marker ╗
+        ║11B00000║00000000║
+        ║  │               ║
+        ║  └── 1: Begin    ║
+        ║      0: End      ║
+        ╚══════════════════╝
+
+        During playback, a begin marker without a matching end marker denotes
+        an interrupted commit -- none of the transaction's entries are applied
+        and the log is consolidated. If the log fills part-way through a commit,
+        the cache (which already holds the complete transaction) is
+        consolidated instead, so the transaction is still applied as a unit. */
+
+#ifndef WEAR_LEVELING_TRANSACTION_MAX_RANGES
+#    define WEAR_LEVELING_TRANSACTION_MAX_RANGES 8
+#endif
 
 /**
  * Storage area for the wear-leveling cache.
@@ -162,6 +186,12 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+    uint8_t                                                        transaction_depth;
+    uint8_t                                                        pending_count;
+    struct {
+        uint32_t from;
+        uint32_t to;
+    } pending[WEAR_LEVELING_TRANSACTION_MAX_RANGES];
 } wear_leveling;
 
 /**
@@ -203,6 +233,7 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling.pending_count = 0;
 }
 
 /**
@@ -469,6 +500,103 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+/**
+ * Appends a transaction boundary marker to the write log.
+ */
+static wear_leveling_status_t wear_leveling_append_transaction_marker(bool begin) {
+    const write_log_entry_t log = LOG_ENTRY_MAKE_TRANSACTION(begin);
+#if BACKING_STORE_WRITE_SIZE == 2
+    return wear_leveling_append_raw(log.raw16[0]);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return wear_leveling_append_raw(log.raw32[0]);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return wear_leveling_append_raw(log.raw64);
+#endif
+}
+
+/**
+ * Records a range of logical data modified during a transaction, merging with existing ranges where possible.
+ */
+static void wear_leveling_transaction_record(uint32_t from, uint32_t to) {
+    // Merge with any overlapping or adjacent range
+    for (uint8_t i = 0; i < wear_leveling.pending_count; ++i) {
+        if (from <= wear_leveling.pending[i].to && to >= wear_leveling.pending[i].from) {
+            if (from < wear_leveling.pending[i].from) wear_leveling.pending[i].from = from;
+            if (to > wear_leveling.pending[i].to) wear_leveling.pending[i].to = to;
+            return;
+        }
+    }
+
+    if (wear_leveling.pending_count < (WEAR_LEVELING_TRANSACTION_MAX_RANGES)) {
+        wear_leveling.pending[wear_leveling.pending_count].from = from;
+        wear_leveling.pending[wear_leveling.pending_count].to   = to;
+        wear_leveling.pending_count++;
+        return;
+    }
+
+    // Out of ranges -- extend whichever range grows the least, at the cost of rewriting unchanged bytes in the gap
+    uint8_t  best      = 0;
+    uint32_t best_cost = UINT32_MAX;
+    for (uint8_t i = 0; i < wear_leveling.pending_count; ++i) {
+        uint32_t new_from = from < wear_leveling.pending[i].from ? from : wear_leveling.pending[i].from;
+        uint32_t new_to   = to > wear_leveling.pending[i].to ? to : wear_leveling.pending[i].to;
+        uint32_t cost     = (new_to - new_from) - (wear_leveling.pending[i].to - wear_leveling.pending[i].from);
+        if (cost < best_cost) {
+            best      = i;
+            best_cost = cost;
+        }
+    }
+    if (from < wear_leveling.pending[best].from) wear_leveling.pending[best].from = from;
+    if (to > wear_leveling.pending[best].to) wear_leveling.pending[best].to = to;
+}
+
+/**
+ * Determines the number of additional backing store reads required to load the remainder of a multi-byte log entry.
+ */
+static inline uint32_t wear_leveling_multibyte_extra_reads(uint8_t length) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    return 1 + (length > 1 ? 1 : 0) + (length > 3 ? 1 : 0);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return length > 1 ? 1 : 0;
+#elif BACKING_STORE_WRITE_SIZE == 8
+    (void)length;
+    return 0;
+#endif
+}
+
+/**
+ * Scans forward through the write log from the supplied address, checking for the end marker of a transaction.
+ */
+static bool wear_leveling_transaction_is_complete(uint32_t address) {
+    while (address < (WEAR_LEVELING_BACKING_SIZE)) {
+        backing_store_int_t value;
+        if (!backing_store_read(address, &value) || value == 0) {
+            return false;
+        }
+        address += (BACKING_STORE_WRITE_SIZE);
+
+        write_log_entry_t log;
+#if BACKING_STORE_WRITE_SIZE == 2
+        log.raw16[0] = value;
+#elif BACKING_STORE_WRITE_SIZE == 4
+        log.raw32[0] = value;
+#elif BACKING_STORE_WRITE_SIZE == 8
+        log.raw64 = value;
+#endif
+
+        switch (LOG_ENTRY_GET_TYPE(log)) {
+            case LOG_ENTRY_TYPE_MULTIBYTE:
+                address += wear_leveling_multibyte_extra_reads(LOG_ENTRY_MULTIBYTE_GET_LENGTH(log)) * (BACKING_STORE_WRITE_SIZE);
+                break;
+            case LOG_ENTRY_TYPE_TRANSACTION:
+                return !LOG_ENTRY_TRANSACTION_IS_BEGIN(log);
+            default:
+                break;
+        }
+    }
+    return false;
+}
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
@@ -590,6 +718,14 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 wear_leveling.cache[a + 1] = 0;
             } break;
 #endif // BACKING_STORE_WRITE_SIZE == 2
+            case LOG_ENTRY_TYPE_TRANSACTION: {
+                // Only play back a transaction if the commit completed, otherwise treat the remainder of the log as corrupt
+                if (LOG_ENTRY_TRANSACTION_IS_BEGIN(log) && !wear_leveling_transaction_is_complete(address)) {
+                    wl_dprintf("Incomplete transaction, skipping remainder of write log\n");
+                    cancel_playback = true;
+                    status          = WEAR_LEVELING_FAILED;
+                }
+            } break;
             default: {
                 cancel_playback = true;
                 status          = WEAR_LEVELING_FAILED;
@@ -617,8 +753,9 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 wear_leveling_status_t wear_leveling_init(void) {
     wl_dprintf("Init\n");
 
-    // Reset the cache
+    // Reset the cache, discarding any open transaction
     wear_leveling_clear_cache();
+    wear_leveling.transaction_depth = 0;
 
     // Initialise the backing store
     if (!backing_store_init()) {
@@ -691,6 +828,12 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
+    // Defer writing to the backing store until the transaction is committed
+    if (wear_leveling.transaction_depth > 0) {
+        wear_leveling_transaction_record(address, address + length);
+        return WEAR_LEVELING_SUCCESS;
+    }
+
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -726,6 +869,59 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+/**
+ * Begins a write transaction.
+ */
+wear_leveling_status_t wear_leveling_transaction_begin(void) {
+    if (wear_leveling.transaction_depth == UINT8_MAX) {
+        return WEAR_LEVELING_FAILED;
+    }
+    wear_leveling.transaction_depth++;
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Commits a write transaction, appending all modified ranges to the write log as a single unit.
+ */
+wear_leveling_status_t wear_leveling_transaction_commit(void) {
+    if (wear_leveling.transaction_depth == 0) {
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // Only the outermost commit writes to the backing store
+    if (--wear_leveling.transaction_depth > 0 || wear_leveling.pending_count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Commit %d range(s)\n", (int)wear_leveling.pending_count);
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // If consolidation occurs at any point, the consolidated data already contains the complete transaction and nothing else needs to occur.
+    wear_leveling_status_t status = wear_leveling_append_transaction_marker(true);
+    for (uint8_t i = 0; i < wear_leveling.pending_count && status == WEAR_LEVELING_SUCCESS; ++i) {
+        const uint32_t from = wear_leveling.pending[i].from;
+        status              = wear_leveling_write_raw(from, &wear_leveling.cache[from], wear_leveling.pending[i].to - from);
+    }
+    if (status == WEAR_LEVELING_SUCCESS) {
+        status = wear_leveling_append_transaction_marker(false);
+    }
+    wear_leveling.pending_count = 0;
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
 /**
  * Reads logical data from the cache.
  */
@@ -52,3 +52,24 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Begins a write transaction.
+ *
+ * Subsequent writes only update the cache, and are recorded as pending until the transaction is committed. Nested
+ * transactions are permitted -- only the outermost commit writes to the backing store.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_transaction_begin(void);
+
+/**
+ * Commits a write transaction.
+ *
+ * All data written since the corresponding wear_leveling_transaction_begin() is appended to the write log as a single
+ * unit, delimited by transaction markers. If power is lost part-way through, the incomplete transaction is discarded
+ * during playback of the write log on the next initialisation.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_transaction_commit(void);
@@ -101,6 +101,9 @@ enum {
     // 0x02 -- 2-byte backing store write optimization: word-encoded 0/1 values
     LOG_ENTRY_TYPE_WORD_01,
 
+    // 0x03 -- Transaction boundary marker
+    LOG_ENTRY_TYPE_TRANSACTION,
+
     LOG_ENTRY_TYPES
 };
 
@@ -149,3 +152,13 @@ _Static_assert(LOG_ENTRY_TYPES <= (1 << 2), "Too many log entry types to fit int
             [1] = (uint8_t)((address) >> 1), /* address */                                            \
         }                                                                                             \
     }
+
+#define LOG_ENTRY_TRANSACTION_IS_BEGIN(entry) ((uint8_t)((entry).raw8[0] >> 5) & BITMASK_FOR_BITCOUNT(1))
+#define LOG_ENTRY_MAKE_TRANSACTION(begin)                                                                  \
+    (write_log_entry_t) {                                                                                  \
+        .raw8 = {                                                                                          \
+            [0] = (((((uint8_t)LOG_ENTRY_TYPE_TRANSACTION) & BITMASK_FOR_BITCOUNT(2)) << 6) /* type */     \
+                   | (((((uint8_t)((begin) ? 1 : 0))) & BITMASK_FOR_BITCOUNT(1)) << 5)      /* begin/end */ \
+                   ),                                                                                      \
+        }                                                                                                  \
+    }
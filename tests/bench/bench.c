@@ -0,0 +1,86 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * Benchmark runner.
+ *
+ * Each benchmark is first run with an increasing number of iterations until
+ * it lasts at least BENCH_MIN_TIME_NS, and then BENCH_RUNS more times with
+ * that number. The fastest and the median time per iteration are printed as
+ * JSON, so that results can be compared across releases.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+
+#ifndef BENCH_MIN_TIME_NS
+#    define BENCH_MIN_TIME_NS 20000000ULL
+#endif
+
+#ifndef BENCH_RUNS
+#    define BENCH_RUNS 5
+#endif
+
+static uint64_t          start_ns;
+static volatile uint32_t sink;
+
+static uint64_t now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+void bench_reset_timer(void) {
+    start_ns = now_ns();
+}
+
+void bench_keep(uint32_t value) {
+    sink = value;
+}
+
+static uint64_t measure(const bench_t *bench, uint32_t iterations) {
+    bench_reset_timer();
+    bench->run(iterations);
+    return now_ns() - start_ns;
+}
+
+static int compare_doubles(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv) {
+    const char *filter = argc > 1 ? argv[1] : NULL;
+    bool        first  = true;
+
+    printf("{\n    \"suite\": \"%s\",\n    \"benchmarks\": [", BENCH_SUITE_NAME);
+    for (size_t i = 0; i < benchmark_count; i++) {
+        const bench_t *bench = &benchmarks[i];
+        if (filter && !strstr(bench->name, filter)) {
+            continue;
+        }
+
+        uint32_t iterations = 1;
+        while (measure(bench, iterations) < BENCH_MIN_TIME_NS && iterations < UINT32_MAX / 2) {
+            iterations *= 2;
+        }
+
+        double ns_per_op[BENCH_RUNS];
+        for (int run = 0; run < BENCH_RUNS; run++) {
+            ns_per_op[run] = (double)measure(bench, iterations) / iterations;
+        }
+        qsort(ns_per_op, BENCH_RUNS, sizeof(double), compare_doubles);
+
+        printf("%s\n        {\"name\": \"%s\", \"iterations\": %u, \"ns_per_op\": %.2f, \"min_ns_per_op\": %.2f}", first ? "" : ",", bench->name, iterations, ns_per_op[BENCH_RUNS / 2], ns_per_op[0]);
+        fflush(stdout);
+        first = false;
+    }
+    printf("\n    ]\n}\n");
+
+    return EXIT_SUCCESS;
+}
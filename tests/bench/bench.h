@@ -0,0 +1,37 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @struct A benchmark, whose function performs the measured operation the given number of times.
+ */
+typedef struct {
+    const char *name;
+    void (*run)(uint32_t iterations);
+} bench_t;
+
+#define BENCH(func) {#func, func}
+
+/**
+ * Defines the benchmarks of an executable, which are run in order.
+ */
+#define BENCH_SUITE(...)                    \
+    const bench_t benchmarks[] = {__VA_ARGS__}; \
+    const size_t  benchmark_count = sizeof(benchmarks) / sizeof(benchmarks[0])
+
+extern const bench_t benchmarks[];
+extern const size_t  benchmark_count;
+
+/**
+ * Restarts the measurement, so that the setup done so far by a benchmark isn't accounted for.
+ */
+void bench_reset_timer(void);
+
+/**
+ * Keeps the compiler from optimizing away the computation of a value.
+ */
+void bench_keep(uint32_t value);
@@ -0,0 +1,30 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench.h"
+#include "color.h"
+
+// Walks through hue, saturation and value at different rates, like an effect would across LEDs
+static inline hsv_t nth_hsv(uint32_t i) {
+    return (hsv_t){.h = i * 7, .s = 255 - (i % 64), .v = i * 3};
+}
+
+static void hsv_to_rgb_cie(uint32_t iterations) {
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        rgb_t rgb = hsv_to_rgb(nth_hsv(i));
+        sum += rgb.r + rgb.g + rgb.b;
+    }
+    bench_keep(sum);
+}
+
+static void hsv_to_rgb_linear(uint32_t iterations) {
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        rgb_t rgb = hsv_to_rgb_nocie(nth_hsv(i));
+        sum += rgb.r + rgb.g + rgb.b;
+    }
+    bench_keep(sum);
+}
+
+BENCH_SUITE(BENCH(hsv_to_rgb_cie), BENCH(hsv_to_rgb_linear));
@@ -0,0 +1,66 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "bench.h"
+#include "debounce.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+
+static matrix_row_t raw[MATRIX_ROWS];
+static matrix_row_t cooked[MATRIX_ROWS];
+
+static void debounce_start(void) {
+    memset(raw, 0, sizeof(raw));
+    memset(cooked, 0, sizeof(cooked));
+    set_time(0);
+    debounce_init(MATRIX_ROWS);
+    bench_reset_timer();
+}
+
+static void debounce_stop(void) {
+    bench_keep(cooked[0]);
+    debounce_free();
+}
+
+// Nothing changes, which is what most scans see
+static void debounce_idle(uint32_t iterations) {
+    debounce_start();
+    for (uint32_t i = 0; i < iterations; i++) {
+        debounce(raw, cooked, MATRIX_ROWS, false);
+        advance_time(1);
+    }
+    debounce_stop();
+}
+
+// A clean press or release on a different key every 2 * DEBOUNCE scans
+static void debounce_typing(uint32_t iterations) {
+    debounce_start();
+    for (uint32_t i = 0; i < iterations; i++) {
+        bool changed = i % (DEBOUNCE * 2) == 0;
+        if (changed) {
+            uint32_t key = (i / (DEBOUNCE * 4)) % (MATRIX_ROWS * MATRIX_COLS);
+            raw[key / MATRIX_COLS] ^= (matrix_row_t)1 << (key % MATRIX_COLS);
+        }
+        debounce(raw, cooked, MATRIX_ROWS, changed);
+        advance_time(1);
+    }
+    debounce_stop();
+}
+
+// A few keys in different rows bounce on every scan
+static void debounce_chatter(uint32_t iterations) {
+    debounce_start();
+    for (uint32_t i = 0; i < iterations; i++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row += 2) {
+            raw[row] ^= (matrix_row_t)1 << ((i + row) % MATRIX_COLS);
+        }
+        debounce(raw, cooked, MATRIX_ROWS, true);
+        advance_time(1);
+    }
+    debounce_stop();
+}
+
+BENCH_SUITE(BENCH(debounce_idle), BENCH(debounce_typing), BENCH(debounce_chatter));
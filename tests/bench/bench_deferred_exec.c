@@ -0,0 +1,59 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "bench.h"
+#include "deferred_exec.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+
+// As many executors as a display-heavy build may have queued at once
+#define BENCH_EXECUTORS 64
+
+// Far enough away that no executor comes due, however many iterations are run
+#define BENCH_DELAY 0x40000000UL
+
+static deferred_executor_t executors[BENCH_EXECUTORS];
+static deferred_token      tokens[BENCH_EXECUTORS];
+static uint32_t            last_exec;
+
+static uint32_t noop_callback(uint32_t trigger_time, void *cb_arg) {
+    return 0;
+}
+
+static void deferred_exec_start(void) {
+    memset(executors, 0, sizeof(executors));
+    last_exec = 0;
+    set_time(0);
+    for (int i = 0; i < BENCH_EXECUTORS; i++) {
+        tokens[i] = defer_exec_advanced(executors, BENCH_EXECUTORS, BENCH_DELAY + i, noop_callback, NULL);
+    }
+    bench_reset_timer();
+}
+
+// A full table with nothing due, which is what most passes of the main loop see
+static void deferred_exec_idle_task(uint32_t iterations) {
+    deferred_exec_start();
+    for (uint32_t i = 0; i < iterations; i++) {
+        advance_time(1);
+        deferred_exec_advanced_task(executors, BENCH_EXECUTORS, &last_exec);
+    }
+}
+
+// Each iteration cancels an executor and queues a new one in its place
+static void deferred_exec_cancel_and_defer(uint32_t iterations) {
+    deferred_exec_start();
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t slot = i % BENCH_EXECUTORS;
+        cancel_deferred_exec_advanced(executors, BENCH_EXECUTORS, tokens[slot]);
+        tokens[slot] = defer_exec_advanced(executors, BENCH_EXECUTORS, BENCH_DELAY + i, noop_callback, NULL);
+    }
+    bench_keep(tokens[0]);
+}
+
+BENCH_SUITE(
+    BENCH(deferred_exec_idle_task),
+    BENCH(deferred_exec_cancel_and_defer)
+);
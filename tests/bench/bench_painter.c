@@ -0,0 +1,76 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench.h"
+#include "qp.h"
+#include "qp_surface.h"
+
+#define SURFACE_WIDTH 240
+#define SURFACE_HEIGHT 320
+
+// Assets generated by `qmk painter-convert-graphics` and `qmk painter-convert-font-image`
+extern const uint8_t gfx_ghoul_logo[];
+extern const uint8_t font_thintel15[];
+
+static uint8_t          framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16)];
+static painter_device_t surface;
+
+static void bench_start(void) {
+    if (!surface) {
+        surface = qp_make_rgb565_surface(SURFACE_WIDTH, SURFACE_HEIGHT, framebuffer);
+        qp_init(surface, QP_ROTATION_0);
+    }
+    qp_clear(surface);
+}
+
+static void qgf_load(uint32_t iterations) {
+    bench_start();
+    bench_reset_timer();
+    for (uint32_t i = 0; i < iterations; i++) {
+        painter_image_handle_t image = qp_load_image_mem(gfx_ghoul_logo);
+        bench_keep(image->width);
+        qp_close_image(image);
+    }
+}
+
+// Each iteration decodes the whole image
+static void qgf_drawimage(uint32_t iterations) {
+    bench_start();
+    painter_image_handle_t image = qp_load_image_mem(gfx_ghoul_logo);
+    bench_reset_timer();
+    for (uint32_t i = 0; i < iterations; i++) {
+        qp_drawimage(surface, 0, 0, image);
+    }
+    qp_close_image(image);
+    bench_keep(framebuffer[0]);
+}
+
+static void qgf_drawimage_recolor(uint32_t iterations) {
+    bench_start();
+    painter_image_handle_t image = qp_load_image_mem(gfx_ghoul_logo);
+    bench_reset_timer();
+    for (uint32_t i = 0; i < iterations; i++) {
+        qp_drawimage_recolor(surface, 0, 0, image, i, 255, 255, 0, 0, 0);
+    }
+    qp_close_image(image);
+    bench_keep(framebuffer[0]);
+}
+
+// Each iteration draws a line of 40 glyphs
+static void qff_drawtext(uint32_t iterations) {
+    bench_start();
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    bench_reset_timer();
+    for (uint32_t i = 0; i < iterations; i++) {
+        qp_drawtext(surface, 0, 0, font, "The quick brown fox jumps over 0123456789");
+    }
+    qp_close_font(font);
+    bench_keep(framebuffer[0]);
+}
+
+BENCH_SUITE(
+    BENCH(qgf_load),
+    BENCH(qgf_drawimage),
+    BENCH(qgf_drawimage_recolor),
+    BENCH(qff_drawtext)
+);
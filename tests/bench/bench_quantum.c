@@ -0,0 +1,160 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench.h"
+#include "quantum.h"
+#include "keymap_introspection.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+
+// Keys of the base layer in keymap.c
+#define POS_Q MAKE_KEYPOS(0, 1)
+#define POS_W MAKE_KEYPOS(0, 2)
+#define POS_BSPC MAKE_KEYPOS(0, 11)
+#define POS_V MAKE_KEYPOS(2, 4)
+#define POS_N MAKE_KEYPOS(2, 6)
+#define POS_NO MAKE_KEYPOS(3, 3)
+
+static void bench_start(void) {
+    static bool initialized = false;
+    if (!initialized) {
+        keyboard_init();
+        initialized = true;
+    }
+    set_time(0);
+    clear_keyboard();
+    layer_clear();
+}
+
+static keyrecord_t make_record(keypos_t key, bool pressed) {
+    return (keyrecord_t){.event = MAKE_KEYEVENT(key.row, key.col, pressed)};
+}
+
+static void layer_lookup(uint32_t iterations) {
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        sum += layer_switch_get_layer(MAKE_KEYPOS(i % MATRIX_ROWS, i % MATRIX_COLS));
+    }
+    bench_keep(sum);
+}
+
+static void layer_switch_get_layer_base(uint32_t iterations) {
+    bench_start();
+    bench_reset_timer();
+    layer_lookup(iterations);
+}
+
+// Every layer is on and transparent, the worst case for the lookup
+static void layer_switch_get_layer_stacked(uint32_t iterations) {
+    bench_start();
+    for (uint8_t layer = 1; layer < keymap_layer_count(); layer++) {
+        layer_on(layer);
+    }
+    bench_reset_timer();
+    layer_lookup(iterations);
+}
+
+// KC_NO isn't owned by any handler, so it goes through the whole chain
+static void process_record_quantum_unowned_key(uint32_t iterations) {
+    bench_start();
+    bench_reset_timer();
+    for (uint32_t i = 0; i < iterations; i++) {
+        keyrecord_t record = make_record(POS_NO, !(i & 1));
+        process_record_quantum(&record);
+    }
+}
+
+static void process_combo_unrelated_key(uint32_t iterations) {
+    bench_start();
+    bench_reset_timer();
+    for (uint32_t i = 0; i < iterations; i++) {
+        keypos_t    key     = i & 1 ? POS_V : POS_N;
+        uint16_t    keycode = i & 1 ? KC_V : KC_N;
+        keyrecord_t press   = make_record(key, true);
+        keyrecord_t release = make_record(key, false);
+        bench_keep(process_combo(keycode, &press) && process_combo(keycode, &release));
+    }
+}
+
+// Presses and releases both keys of a combo, which fires it on the first release
+static void process_combo_chord(uint32_t iterations) {
+    bench_start();
+    bench_reset_timer();
+    for (uint32_t i = 0; i < iterations; i++) {
+        keyrecord_t press_q   = make_record(POS_Q, true);
+        keyrecord_t press_w   = make_record(POS_W, true);
+        keyrecord_t release_q = make_record(POS_Q, false);
+        keyrecord_t release_w = make_record(POS_W, false);
+        process_combo(KC_Q, &press_q);
+        advance_time(1);
+        process_combo(KC_W, &press_w);
+        advance_time(1);
+        process_combo(KC_Q, &release_q);
+        process_combo(KC_W, &release_w);
+        advance_time(1);
+    }
+}
+
+static void process_key_override_unrelated_key(uint32_t iterations) {
+    bench_start();
+    bench_reset_timer();
+    for (uint32_t i = 0; i < iterations; i++) {
+        keyrecord_t press   = make_record(POS_V, true);
+        keyrecord_t release = make_record(POS_V, false);
+        bench_keep(process_key_override(KC_V, &press) && process_key_override(KC_V, &release));
+    }
+}
+
+// Shift + Backspace, the last override to be checked
+static void process_key_override_activation(uint32_t iterations) {
+    bench_start();
+    add_mods(MOD_BIT(KC_LSFT));
+    bench_reset_timer();
+    for (uint32_t i = 0; i < iterations; i++) {
+        keyrecord_t press   = make_record(POS_BSPC, true);
+        keyrecord_t release = make_record(POS_BSPC, false);
+        process_key_override(KC_BSPC, &press);
+        process_key_override(KC_BSPC, &release);
+        add_mods(MOD_BIT(KC_LSFT));
+    }
+}
+
+static void type_text(const char *text, uint32_t iterations) {
+    const char *c = text;
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint16_t    keycode = *c == ' ' ? KC_SPC : KC_A + (*c - 'a');
+        keyrecord_t press   = make_record(POS_Q, true);
+        bench_keep(process_autocorrect(keycode, &press));
+        if (*++c == '\0') {
+            c = text;
+        }
+    }
+}
+
+// Each iteration is a single keystroke
+static void process_autocorrect_typing(uint32_t iterations) {
+    bench_start();
+    autocorrect_enable();
+    bench_reset_timer();
+    type_text("the quick brown fox jumps over the lazy dog ", iterations);
+}
+
+static void process_autocorrect_typos(uint32_t iterations) {
+    bench_start();
+    autocorrect_enable();
+    bench_reset_timer();
+    type_text("becuase fales cosnt fitler ", iterations);
+}
+
+BENCH_SUITE(
+    BENCH(layer_switch_get_layer_base),
+    BENCH(layer_switch_get_layer_stacked),
+    BENCH(process_record_quantum_unowned_key),
+    BENCH(process_combo_unrelated_key),
+    BENCH(process_combo_chord),
+    BENCH(process_key_override_unrelated_key),
+    BENCH(process_key_override_activation),
+    BENCH(process_autocorrect_typing),
+    BENCH(process_autocorrect_typos)
+);
@@ -0,0 +1,106 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "bench.h"
+#include "quantum.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+
+static rgb_t    leds[RGB_MATRIX_LED_COUNT];
+static uint32_t flushes = 0;
+
+static void bench_driver_init(void) {}
+
+static void bench_driver_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    leds[index] = (rgb_t){.r = r, .g = g, .b = b};
+}
+
+static void bench_driver_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        bench_driver_set_color(i, r, g, b);
+    }
+}
+
+static void bench_driver_flush(void) {
+    flushes++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = bench_driver_init,
+    .set_color     = bench_driver_set_color,
+    .set_color_all = bench_driver_set_color_all,
+    .flush         = bench_driver_flush,
+};
+
+// Filled in at startup: one LED per key, laid out as a regular grid
+led_config_t g_led_config;
+
+static void init_led_config(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t index                    = row * MATRIX_COLS + col;
+            g_led_config.matrix_co[row][col] = index;
+            g_led_config.point[index]        = (led_point_t){.x = col * 224 / (MATRIX_COLS - 1), .y = row * 64 / (MATRIX_ROWS - 1)};
+            g_led_config.flags[index]        = row == MATRIX_ROWS - 1 ? LED_FLAG_MODIFIER : LED_FLAG_KEYLIGHT;
+        }
+    }
+}
+
+// Each iteration renders and flushes a whole frame. Reactive effects get a key press every few frames.
+static void render_frames(uint8_t mode, uint32_t iterations) {
+    static bool initialized = false;
+    if (!initialized) {
+        init_led_config();
+        keyboard_init();
+        initialized = true;
+    }
+    set_time(0);
+    rgb_matrix_enable_noeeprom();
+    rgb_matrix_mode_noeeprom(mode);
+    bench_reset_timer();
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        if (i % 4 == 0) {
+            uint8_t row = (i / 4) % MATRIX_ROWS;
+            uint8_t col = (i / 4 * 5) % MATRIX_COLS;
+            rgb_matrix_handle_key_event(row, col, true);
+        }
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        for (uint32_t frame = flushes; flushes == frame;) {
+            rgb_matrix_task();
+        }
+    }
+    bench_keep(leds[0].r + leds[RGB_MATRIX_LED_COUNT - 1].b);
+}
+
+#define EFFECT_BENCH(effect)                            \
+    static void effect(uint32_t iterations) {           \
+        render_frames(RGB_MATRIX_##effect, iterations); \
+    }
+
+EFFECT_BENCH(SOLID_COLOR)
+EFFECT_BENCH(BREATHING)
+EFFECT_BENCH(CYCLE_LEFT_RIGHT)
+EFFECT_BENCH(RAINBOW_MOVING_CHEVRON)
+EFFECT_BENCH(CYCLE_OUT_IN)
+EFFECT_BENCH(DUAL_BEACON)
+EFFECT_BENCH(RAINDROPS)
+EFFECT_BENCH(PIXEL_RAIN)
+EFFECT_BENCH(TYPING_HEATMAP)
+EFFECT_BENCH(SOLID_REACTIVE_SIMPLE)
+EFFECT_BENCH(SPLASH)
+
+BENCH_SUITE(
+    BENCH(SOLID_COLOR),
+    BENCH(BREATHING),
+    BENCH(CYCLE_LEFT_RIGHT),
+    BENCH(RAINBOW_MOVING_CHEVRON),
+    BENCH(CYCLE_OUT_IN),
+    BENCH(DUAL_BEACON),
+    BENCH(RAINDROPS),
+    BENCH(PIXEL_RAIN),
+    BENCH(TYPING_HEATMAP),
+    BENCH(SOLID_REACTIVE_SIMPLE),
+    BENCH(SPLASH)
+);
@@ -0,0 +1,89 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdbool.h>
+
+#include "bench.h"
+#include "wear_leveling.h"
+#include "wear_leveling_internal.h"
+
+// Emulated flash, where erased words read back as zero like they do through the wear-leveling drivers
+static backing_store_int_t backing_store[WEAR_LEVELING_BACKING_SIZE / BACKING_STORE_WRITE_SIZE];
+
+bool backing_store_init(void) {
+    return true;
+}
+
+bool backing_store_unlock(void) {
+    return true;
+}
+
+bool backing_store_erase(void) {
+    memset(backing_store, 0, sizeof(backing_store));
+    return true;
+}
+
+bool backing_store_write(uint32_t address, backing_store_int_t value) {
+    backing_store[address / BACKING_STORE_WRITE_SIZE] = value;
+    return true;
+}
+
+bool backing_store_lock(void) {
+    return true;
+}
+
+bool backing_store_read(uint32_t address, backing_store_int_t *value) {
+    *value = backing_store[address / BACKING_STORE_WRITE_SIZE];
+    return true;
+}
+
+static void wear_leveling_start(void) {
+    backing_store_erase();
+    wear_leveling_init();
+    bench_reset_timer();
+}
+
+// Single bytes spread over the logical space, occasionally triggering a consolidation
+static void wear_leveling_write_byte(uint32_t iterations) {
+    wear_leveling_start();
+    for (uint32_t i = 0; i < iterations; i++) {
+        // Shifted on every pass over the logical space, so that each write changes the stored value
+        uint8_t value = i * 3 + i / WEAR_LEVELING_LOGICAL_SIZE + 1;
+        wear_leveling_write((i * 37) % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value));
+    }
+}
+
+// Config blocks the size of most eeconfig entries
+static void wear_leveling_write_block(uint32_t iterations) {
+    uint8_t block[16];
+    wear_leveling_start();
+    for (uint32_t i = 0; i < iterations; i++) {
+        memset(block, i + i / (WEAR_LEVELING_LOGICAL_SIZE / sizeof(block)) + 1, sizeof(block));
+        wear_leveling_write((i * sizeof(block)) % WEAR_LEVELING_LOGICAL_SIZE, block, sizeof(block));
+    }
+}
+
+// Writes of values that are already stored, which are skipped
+static void wear_leveling_write_unchanged(uint32_t iterations) {
+    uint8_t block[16] = {0};
+    wear_leveling_start();
+    for (uint32_t i = 0; i < iterations; i++) {
+        wear_leveling_write((i * sizeof(block)) % WEAR_LEVELING_LOGICAL_SIZE, block, sizeof(block));
+    }
+}
+
+// Startup, replaying a write log that is half full
+static void wear_leveling_init_replay(uint32_t iterations) {
+    backing_store_erase();
+    wear_leveling_init();
+    for (uint32_t i = 0; i < (WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE) / 8; i++) {
+        uint8_t value = i + 1;
+        wear_leveling_write((i * 37) % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value));
+    }
+    bench_reset_timer();
+    for (uint32_t i = 0; i < iterations; i++) {
+        wear_leveling_init();
+    }
+}
+
+BENCH_SUITE(BENCH(wear_leveling_write_byte), BENCH(wear_leveling_write_block), BENCH(wear_leveling_write_unchanged), BENCH(wear_leveling_init_replay));
@@ -0,0 +1,93 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// Upper layers are transparent, so that lookups have to walk all the way down to the base layer
+#define BENCH_LAYERS 8
+
+// clang-format off
+const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+    [0] = {
+        {KC_TAB,  KC_Q,    KC_W,    KC_E,    KC_R,    KC_T,    KC_Y,    KC_U,    KC_I,    KC_O,    KC_P,    KC_BSPC},
+        {KC_ESC,  KC_A,    KC_S,    KC_D,    KC_F,    KC_G,    KC_H,    KC_J,    KC_K,    KC_L,    KC_SCLN, KC_QUOT},
+        {KC_LSFT, KC_Z,    KC_X,    KC_C,    KC_V,    KC_B,    KC_N,    KC_M,    KC_COMM, KC_DOT,  KC_SLSH, KC_ENT },
+        {KC_LCTL, KC_LGUI, KC_LALT, KC_NO,   MO(1),   KC_SPC,  KC_SPC,  MO(2),   KC_NO,   KC_RALT, KC_RGUI, KC_RCTL}
+    },
+    [1 ... BENCH_LAYERS - 1] = {[0 ... MATRIX_ROWS - 1] = {[0 ... MATRIX_COLS - 1] = KC_TRNS}}
+};
+// clang-format on
+
+#ifdef COMBO_ENABLE
+#    define BENCH_COMBO(a, b) const uint16_t PROGMEM combo_##a##b[] = {KC_##a, KC_##b, COMBO_END}
+BENCH_COMBO(Q, W);
+BENCH_COMBO(W, E);
+BENCH_COMBO(E, R);
+BENCH_COMBO(R, T);
+BENCH_COMBO(Y, U);
+BENCH_COMBO(U, I);
+BENCH_COMBO(I, O);
+BENCH_COMBO(O, P);
+BENCH_COMBO(A, S);
+BENCH_COMBO(S, D);
+BENCH_COMBO(D, F);
+BENCH_COMBO(F, G);
+BENCH_COMBO(H, J);
+BENCH_COMBO(J, K);
+BENCH_COMBO(K, L);
+BENCH_COMBO(Z, X);
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(combo_QW, KC_1),
+    COMBO(combo_WE, KC_2),
+    COMBO(combo_ER, KC_3),
+    COMBO(combo_RT, KC_4),
+    COMBO(combo_YU, KC_5),
+    COMBO(combo_UI, KC_6),
+    COMBO(combo_IO, KC_7),
+    COMBO(combo_OP, KC_8),
+    COMBO(combo_AS, KC_9),
+    COMBO(combo_SD, KC_0),
+    COMBO(combo_DF, KC_MINS),
+    COMBO(combo_FG, KC_EQL),
+    COMBO(combo_HJ, KC_LBRC),
+    COMBO(combo_JK, KC_RBRC),
+    COMBO(combo_KL, KC_BSLS),
+    COMBO(combo_ZX, KC_GRV)
+};
+// clang-format on
+#endif
+
+#ifdef KEY_OVERRIDE_ENABLE
+#    define ALT_LETTER(letter, replacement) static const key_override_t alt_##letter = ko_make_basic(MOD_MASK_ALT, KC_##letter, replacement)
+ALT_LETTER(Q, KC_1);
+ALT_LETTER(W, KC_2);
+ALT_LETTER(E, KC_3);
+ALT_LETTER(R, KC_4);
+ALT_LETTER(T, KC_5);
+ALT_LETTER(Y, KC_6);
+ALT_LETTER(U, KC_7);
+ALT_LETTER(I, KC_8);
+ALT_LETTER(O, KC_9);
+ALT_LETTER(P, KC_0);
+static const key_override_t shift_backspace = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+static const key_override_t ctrl_escape     = ko_make_basic(MOD_MASK_CTRL, KC_ESC, KC_GRV);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &alt_Q,
+    &alt_W,
+    &alt_E,
+    &alt_R,
+    &alt_T,
+    &alt_Y,
+    &alt_U,
+    &alt_I,
+    &alt_O,
+    &alt_P,
+    &ctrl_escape,
+    &shift_backspace
+};
+// clang-format on
+#endif
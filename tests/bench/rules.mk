@@ -0,0 +1,95 @@
+# Benchmarks are defined the same way as unit tests, and listed in benchlist.mk.
+# <name>_FEATURES enables features as a keyboard's rules.mk would, making their
+# sources available through $(QUANTUM_SRC) and $(SRC).
+
+DEBOUNCE_BENCH_DEFS := -DMATRIX_ROWS=8 -DMATRIX_COLS=16 -DDEBOUNCE=5
+
+DEBOUNCE_BENCH_SRC := \
+	$(BENCH_PATH)/bench_debounce.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+bench_debounce_none_DEFS := $(DEBOUNCE_BENCH_DEFS)
+bench_debounce_none_SRC := $(DEBOUNCE_BENCH_SRC) \
+	$(QUANTUM_PATH)/debounce/none.c
+
+bench_debounce_sym_defer_g_DEFS := $(DEBOUNCE_BENCH_DEFS)
+bench_debounce_sym_defer_g_SRC := $(DEBOUNCE_BENCH_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_g.c
+
+bench_debounce_sym_defer_pk_DEFS := $(DEBOUNCE_BENCH_DEFS)
+bench_debounce_sym_defer_pk_SRC := $(DEBOUNCE_BENCH_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c
+
+bench_debounce_sym_defer_pr_DEFS := $(DEBOUNCE_BENCH_DEFS)
+bench_debounce_sym_defer_pr_SRC := $(DEBOUNCE_BENCH_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pr.c
+
+bench_debounce_sym_eager_pk_DEFS := $(DEBOUNCE_BENCH_DEFS)
+bench_debounce_sym_eager_pk_SRC := $(DEBOUNCE_BENCH_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_pk.c
+
+bench_debounce_sym_eager_pr_DEFS := $(DEBOUNCE_BENCH_DEFS)
+bench_debounce_sym_eager_pr_SRC := $(DEBOUNCE_BENCH_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_pr.c
+
+bench_debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_BENCH_DEFS)
+bench_debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_BENCH_SRC) \
+	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c
+
+bench_color_DEFS := -DUSE_CIE1931_CURVE
+bench_color_SRC := \
+	$(BENCH_PATH)/bench_color.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/led_tables.c
+
+bench_deferred_exec_SRC := \
+	$(BENCH_PATH)/bench_deferred_exec.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+bench_wear_leveling_DEFS := \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=16384 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=4096
+bench_wear_leveling_SRC := \
+	$(BENCH_PATH)/bench_wear_leveling.c \
+	$(LIB_PATH)/fnv/qmk_fnv_type_validation.c \
+	$(LIB_PATH)/fnv/hash_32a.c \
+	$(LIB_PATH)/fnv/hash_64a.c \
+	$(QUANTUM_PATH)/wear_leveling/wear_leveling.c
+bench_wear_leveling_INC := \
+	$(LIB_PATH)/fnv \
+	$(QUANTUM_PATH)/wear_leveling
+
+bench_quantum_FEATURES := COMBO KEY_OVERRIDE AUTOCORRECT
+bench_quantum_SRC = \
+	$(QUANTUM_SRC) \
+	$(SRC) \
+	$(QUANTUM_PATH)/keymap_introspection.c \
+	$(BENCH_PATH)/bench_quantum.c
+bench_quantum_DEFS = $(OPT_DEFS) -DKEYMAP_C=\"keymap.c\"
+bench_quantum_CONFIG := $(BENCH_PATH)/config.h
+
+bench_rgb_matrix_FEATURES := RGB_MATRIX
+RGB_MATRIX_DRIVER := custom
+bench_rgb_matrix_SRC = \
+	$(QUANTUM_SRC) \
+	$(SRC) \
+	$(QUANTUM_PATH)/keymap_introspection.c \
+	$(BENCH_PATH)/bench_rgb_matrix.c
+bench_rgb_matrix_DEFS = $(OPT_DEFS) -DKEYMAP_C=\"keymap.c\"
+bench_rgb_matrix_CONFIG := $(BENCH_PATH)/config.h
+
+bench_painter_FEATURES := QUANTUM_PAINTER
+QUANTUM_PAINTER_DRIVERS := surface
+bench_painter_SRC = \
+	$(QUANTUM_SRC) \
+	$(SRC) \
+	$(QUANTUM_PATH)/keymap_introspection.c \
+	$(BENCH_PATH)/bench_painter.c \
+	keyboards/tzarc/ghoul/graphics/ghoul-logo.qgf.c \
+	keyboards/tzarc/ghoul/graphics/thintel15.qff.c
+bench_painter_DEFS = $(OPT_DEFS) -DKEYMAP_C=\"keymap.c\"
+bench_painter_CONFIG := $(BENCH_PATH)/config.h
@@ -0,0 +1,55 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// Shift + Backspace = Delete
+static const key_override_t shift_backspace = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+
+// Two overrides for the same combination, only the first one defined should ever activate
+static const key_override_t ctrl_escape_first  = ko_make_basic(MOD_MASK_CTRL, KC_ESC, KC_F1);
+static const key_override_t ctrl_escape_second = ko_make_basic(MOD_MASK_CTRL, KC_ESC, KC_F2);
+
+// Overrides without a trigger key, interleaved with one that has a trigger
+static const key_override_t ctrl_alt_no_trigger = ko_make_basic(MOD_MASK_CA, KC_NO, KC_F3);
+static const key_override_t ctrl_alt_tab        = ko_make_basic(MOD_MASK_CA, KC_TAB, KC_F4);
+static const key_override_t gui_alt_tab         = ko_make_basic(MOD_MASK_AG, KC_TAB, KC_F5);
+static const key_override_t gui_alt_no_trigger  = ko_make_basic(MOD_MASK_AG, KC_NO, KC_F6);
+
+// A block of Alt + letter overrides to spread the triggers out
+#define ALT_LETTER(letter, replacement) static const key_override_t alt_##letter = ko_make_basic(MOD_MASK_ALT, KC_##letter, replacement)
+ALT_LETTER(Z, KC_1);
+ALT_LETTER(Y, KC_2);
+ALT_LETTER(X, KC_3);
+ALT_LETTER(W, KC_4);
+ALT_LETTER(V, KC_5);
+ALT_LETTER(U, KC_6);
+ALT_LETTER(T, KC_7);
+ALT_LETTER(S, KC_8);
+ALT_LETTER(R, KC_9);
+ALT_LETTER(Q, KC_0);
+
+// Shift + A = B, not in the list but swapped in for Shift + Backspace by the tests
+const key_override_t shift_a = ko_make_basic(MOD_MASK_SHIFT, KC_A, KC_B);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &alt_Z,
+    &shift_backspace,
+    &alt_Y,
+    &ctrl_escape_first,
+    &alt_X,
+    &ctrl_escape_second,
+    &alt_W,
+    &ctrl_alt_no_trigger,
+    &ctrl_alt_tab,
+    &alt_V,
+    &gui_alt_tab,
+    &gui_alt_no_trigger,
+    &alt_U,
+    &alt_T,
+    &alt_S,
+    &alt_R,
+    &alt_Q,
+};
+// clang-format on
@@ -0,0 +1,268 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+extern "C" {
+#include "keymap_introspection.h"
+extern const key_override_t shift_a;
+}
+
+static bool swap_shift_backspace = false;
+
+extern "C" const key_override_t *key_override_get(uint16_t key_override_idx) {
+    const key_override_t *override = key_override_get_raw(key_override_idx);
+    if (swap_shift_backspace && override != NULL && override->trigger == KC_BSPC) {
+        return &shift_a;
+    }
+    return override;
+}
+
+class KeyOverride : public TestFixture {
+   public:
+    ~KeyOverride() {
+        swap_shift_backspace = false;
+        key_override_invalidate_index();
+    }
+};
+
+TEST_F(KeyOverride, TriggerWithModsSendsReplacement) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  shift     = KeymapKey(0, 0, 0, KC_LSFT);
+    KeymapKey  backspace = KeymapKey(0, 1, 0, KC_BSPC);
+    set_keymap({shift, backspace});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    backspace.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    backspace.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, TriggerWithoutModsIsUnaffected) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  backspace = KeymapKey(0, 1, 0, KC_BSPC);
+    set_keymap({backspace});
+
+    EXPECT_REPORT(driver, (KC_BSPC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(backspace);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, FirstDefinedOverrideWins) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  ctrl   = KeymapKey(0, 0, 0, KC_LCTL);
+    KeymapKey  escape = KeymapKey(0, 1, 0, KC_ESC);
+    set_keymap({ctrl, escape});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    ctrl.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_F1));
+    EXPECT_REPORT(driver, (KC_LCTL));
+    tap_key(escape);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, OverridesAreMatchedByTrigger) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  alt   = KeymapKey(0, 0, 0, KC_LALT);
+    KeymapKey  key_z = KeymapKey(0, 1, 0, KC_Z);
+    KeymapKey  key_q = KeymapKey(0, 2, 0, KC_Q);
+    KeymapKey  key_a = KeymapKey(0, 3, 0, KC_A);
+    set_keymap({alt, key_z, key_q, key_a});
+
+    EXPECT_REPORT(driver, (KC_LALT));
+    alt.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_REPORT(driver, (KC_LALT));
+    tap_key(key_z);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_0));
+    EXPECT_REPORT(driver, (KC_LALT));
+    tap_key(key_q);
+    VERIFY_AND_CLEAR(driver);
+
+    // No override is defined for this one
+    EXPECT_REPORT(driver, (KC_LALT, KC_A));
+    EXPECT_REPORT(driver, (KC_LALT));
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    alt.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, ModsPressedAfterTriggerActivateOverride) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  shift     = KeymapKey(0, 0, 0, KC_LSFT);
+    KeymapKey  backspace = KeymapKey(0, 1, 0, KC_BSPC);
+    set_keymap({shift, backspace});
+
+    EXPECT_REPORT(driver, (KC_BSPC));
+    backspace.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The trigger is lifted straight away, but the replacement is only registered after the repeat delay
+    EXPECT_EMPTY_REPORT(driver);
+    shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    // Releasing the mod deactivates the override, and the trigger is registered again shortly after
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_BSPC));
+    shift.release();
+    run_one_scan_loop();
+    idle_for(50);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    backspace.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, TriggeredOverrideTakesOverFromModOnlyOverride) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  ctrl = KeymapKey(0, 0, 0, KC_LCTL);
+    KeymapKey  alt  = KeymapKey(0, 1, 0, KC_LALT);
+    KeymapKey  tab  = KeymapKey(0, 2, 0, KC_TAB);
+    set_keymap({ctrl, alt, tab});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    ctrl.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Ctrl + Alt activates the override without a trigger, whose replacement is deferred
+    EXPECT_EMPTY_REPORT(driver);
+    alt.press();
+    run_one_scan_loop();
+    idle_for(50);
+    VERIFY_AND_CLEAR(driver);
+
+    // Tab hands over to the override with the trigger, defined after it
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LALT));
+    EXPECT_REPORT(driver, (KC_F4));
+    tab.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LALT));
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_EMPTY_REPORT(driver);
+    tab.release();
+    run_one_scan_loop();
+    alt.release();
+    run_one_scan_loop();
+    ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, DisabledOverridesDoNotActivate) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  shift     = KeymapKey(0, 0, 0, KC_LSFT);
+    KeymapKey  backspace = KeymapKey(0, 1, 0, KC_BSPC);
+    set_keymap({shift, backspace});
+
+    key_override_off();
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_BSPC));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    shift.press();
+    run_one_scan_loop();
+    tap_key(backspace);
+    shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_override_on();
+}
+
+TEST_F(KeyOverride, ChangedOverridesApplyAfterInvalidatingIndex) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  shift     = KeymapKey(0, 0, 0, KC_LSFT);
+    KeymapKey  backspace = KeymapKey(0, 1, 0, KC_BSPC);
+    KeymapKey  key_a     = KeymapKey(0, 2, 0, KC_A);
+    set_keymap({shift, backspace, key_a});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Builds the index for the original overrides
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    swap_shift_backspace = true;
+    key_override_invalidate_index();
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT, KC_BSPC));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(backspace);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,40 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+// clang-format off
+
+#define LEADER_SEQUENCES_COUNT 4
+#define LEADER_SEQUENCES_MAX_LENGTH 3
+#define LEADER_SEQUENCES_TRIE_SIZE 22
+
+static const uint16_t leader_sequences_trie[LEADER_SEQUENCES_TRIE_SIZE] PROGMEM = {
+    2, KC_NO, KC_F, 6, KC_G, 12, // root
+    2, KC_NO, KC_D, 14, KC_J, 18, // KC_F
+    0, C(KC_C), // KC_G
+    1, KC_1, KC_S, 20, // KC_F, KC_D
+    0, KC_3, // KC_F, KC_J
+    0, KC_2, // KC_F, KC_D, KC_S
+};
@@ -0,0 +1,152 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+// leader_sequences.h is generated from the following keymap.json entries:
+//   KC_F, KC_D       -> KC_1
+//   KC_F, KC_D, KC_S -> KC_2
+//   KC_G             -> C(KC_C)
+//   KC_F, KC_J       -> KC_3
+class LeaderTrie : public TestFixture {};
+
+// Keys passed to leader_add_user(), and whether the sequence was still active at the time
+static std::vector<std::pair<uint16_t, bool>> added_keys;
+
+extern "C" bool leader_add_user(uint16_t keycode) {
+    added_keys.push_back({keycode, leader_sequence_active()});
+    return false;
+}
+
+TEST_F(LeaderTrie, unambiguous_sequence_triggers_immediately) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_g      = KeymapKey(0, 1, 0, KC_G);
+
+    set_keymap({key_leader, key_g});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_C));
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_g);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTrie, ambiguous_sequence_triggers_on_timeout) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_f      = KeymapKey(0, 1, 0, KC_F);
+    auto key_d      = KeymapKey(0, 2, 0, KC_D);
+
+    set_keymap({key_leader, key_f, key_d});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_f);
+    tap_key(key_d);
+    EXPECT_EQ(leader_sequence_active(), true);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTrie, longest_sequence_triggers_immediately) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_f      = KeymapKey(0, 1, 0, KC_F);
+    auto key_d      = KeymapKey(0, 2, 0, KC_D);
+    auto key_s      = KeymapKey(0, 3, 0, KC_S);
+    auto key_j      = KeymapKey(0, 4, 0, KC_J);
+
+    set_keymap({key_leader, key_f, key_d, key_s, key_j});
+
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_f);
+    tap_key(key_d);
+    tap_key(key_s);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_f);
+    tap_key(key_j);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTrie, unmatched_sequence_falls_back_to_leader_end_user) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_f      = KeymapKey(0, 2, 0, KC_F);
+    auto key_s      = KeymapKey(0, 3, 0, KC_S);
+
+    set_keymap({key_leader, key_a, key_f, key_s});
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+
+    // A partial match that is then broken sends nothing
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_f);
+    tap_key(key_s);
+    idle_for(300);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTrie, leader_add_user_runs_before_sequence_ends) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_f      = KeymapKey(0, 1, 0, KC_F);
+    auto key_j      = KeymapKey(0, 2, 0, KC_J);
+
+    set_keymap({key_leader, key_f, key_j});
+    added_keys.clear();
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_f);
+    tap_key(key_j);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+
+    std::vector<std::pair<uint16_t, bool>> expected = {{KC_F, true}, {KC_J, true}};
+    EXPECT_EQ(added_keys, expected);
+}
@@ -0,0 +1,73 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+using testing::InSequence;
+
+class PointingAccumulate : public TestFixture {};
+
+TEST_F(PointingAccumulate, SamplesAreSentInOneReport) {
+    TestDriver driver;
+
+    pd_set_x(10);
+    pd_set_y(-5);
+    pointing_device_sample();
+    pointing_device_sample();
+    pointing_device_sample();
+    pd_clear_movement();
+
+    // Reports are sent at most once every POINTING_DEVICE_TASK_THROTTLE_MS
+    EXPECT_MOUSE_REPORT(driver, (30, -15, 0, 0, 0));
+    idle_for(POINTING_DEVICE_TASK_THROTTLE_MS + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccumulate, MotionBeyondReportRangeIsCarriedOver) {
+    TestDriver driver;
+    InSequence s;
+
+    pd_set_x(100);
+    pd_set_v(-100);
+    pointing_device_sample();
+    pointing_device_sample();
+    pd_clear_movement();
+
+    EXPECT_MOUSE_REPORT(driver, (127, 0, 0, -128, 0));
+    EXPECT_MOUSE_REPORT(driver, (73, 0, 0, -72, 0));
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccumulate, ButtonChangesAreKept) {
+    TestDriver driver;
+    InSequence s;
+
+    pd_press_button(POINTING_DEVICE_BUTTON1);
+    pointing_device_sample();
+    pd_release_button(POINTING_DEVICE_BUTTON1);
+    pd_press_button(POINTING_DEVICE_BUTTON2);
+    pointing_device_sample();
+
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 2));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_release_button(POINTING_DEVICE_BUTTON2);
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,109 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+using testing::InSequence;
+
+namespace {
+
+// Gain ramps from 1x at rest to 2x at 2 counts per report
+const pointing_device_curve_point_t curve[] = {
+    {POINTING_FIXED(0), POINTING_FIXED(1)},
+    {POINTING_FIXED(2), POINTING_FIXED(2)},
+};
+
+bool use_curve = false;
+
+} // namespace
+
+extern "C" pointing_fixed_t pointing_device_acceleration_user(pointing_fixed_t speed) {
+    return use_curve ? pointing_device_curve_gain(curve, sizeof(curve) / sizeof(curve[0]), speed) : POINTING_FIXED_ONE;
+}
+
+class PointingTransform : public TestFixture {
+   public:
+    void SetUp() override {
+        use_curve = false;
+        pointing_device_set_drag_scroll(false);
+        pointing_device_transform_reset();
+        pd_clear_movement();
+    }
+};
+
+TEST_F(PointingTransform, MotionIsUnchangedByDefault) {
+    TestDriver driver;
+
+    pd_set_x(-10);
+    pd_set_v(3);
+    EXPECT_MOUSE_REPORT(driver, (-10, 0, 0, 3, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_clear_movement();
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingTransform, CurveGainIsInterpolated) {
+    EXPECT_EQ(pointing_device_curve_gain(curve, 2, POINTING_FIXED(0)), POINTING_FIXED(1));
+    EXPECT_EQ(pointing_device_curve_gain(curve, 2, POINTING_FIXED(1)), POINTING_FIXED(1.5));
+    EXPECT_EQ(pointing_device_curve_gain(curve, 2, POINTING_FIXED(5)), POINTING_FIXED(2));
+    EXPECT_EQ(pointing_device_curve_gain(curve, 0, POINTING_FIXED(5)), POINTING_FIXED_ONE);
+}
+
+TEST_F(PointingTransform, AccelerationKeepsFractionalCounts) {
+    TestDriver driver;
+    InSequence s;
+
+    // 1 count per report at 1.5x alternates between 1 and 2 counts, rather than truncating to 1
+    use_curve = true;
+    pd_set_x(1);
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (2, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (2, 0, 0, 0, 0));
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_clear_movement();
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingTransform, DragScrollCarriesRemainders) {
+    TestDriver driver;
+    InSequence s;
+
+    // 3/8 of a scroll step per report only scrolls once every few reports
+    pointing_device_set_drag_scroll(true);
+    pd_set_x(3);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 1, 0, 0));
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_set_x(0);
+    pd_set_y(-16);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, -2, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Leftover fractions don't leak into pointer motion once drag scroll is disabled
+    pointing_device_set_drag_scroll(false);
+    pd_set_y(0);
+    pd_set_x(4);
+    EXPECT_MOUSE_REPORT(driver, (4, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,134 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+namespace {
+
+// Keycode that process_record_user() should swallow, KC_NO for none
+uint16_t blocked_keycode = KC_NO;
+
+} // namespace
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    return keycode != blocked_keycode;
+}
+
+class ProcessRecord : public TestFixture {
+   public:
+    void SetUp() override {
+        blocked_keycode = KC_NO;
+        caps_word_off();
+    }
+};
+
+// Ranged handlers run after the user hook, so a keymap can still intercept their keycodes.
+TEST_F(ProcessRecord, UserHookRunsBeforeRangedHandlers) {
+    TestDriver driver;
+    KeymapKey  grave_esc = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+    KeymapKey  lower     = KeymapKey(0, 1, 0, QK_TRI_LAYER_LOWER);
+    set_keymap({grave_esc, lower, KeymapKey(1, 1, 0, KC_TRNS)});
+
+    blocked_keycode = QK_GRAVE_ESCAPE;
+    EXPECT_NO_REPORT(driver);
+    tap_key(grave_esc);
+    VERIFY_AND_CLEAR(driver);
+
+    blocked_keycode = QK_TRI_LAYER_LOWER;
+    EXPECT_NO_REPORT(driver);
+    lower.press();
+    run_one_scan_loop();
+    EXPECT_FALSE(layer_state_is(get_tri_layer_lower_layer()));
+    lower.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Keycodes within a ranged handler's block still reach it once the earlier handlers let them through.
+TEST_F(ProcessRecord, RangedHandlersReceiveTheirKeycodes) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  grave_esc = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+    KeymapKey  lower     = KeymapKey(0, 1, 0, QK_TRI_LAYER_LOWER);
+    KeymapKey  dt_up     = KeymapKey(0, 2, 0, QK_DYNAMIC_TAPPING_TERM_UP);
+    set_keymap({grave_esc, lower, dt_up, KeymapKey(1, 1, 0, KC_TRNS)});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(grave_esc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    lower.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(get_tri_layer_lower_layer()));
+    lower.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(layer_state_is(get_tri_layer_lower_layer()));
+    VERIFY_AND_CLEAR(driver);
+
+    uint16_t tapping_term = g_tapping_term;
+    EXPECT_NO_REPORT(driver);
+    tap_key(dt_up);
+    EXPECT_EQ(g_tapping_term, tapping_term + DYNAMIC_TAPPING_TERM_INCREMENT);
+    g_tapping_term = tapping_term;
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Keycodes outside every handler's block pass through the whole chain to the action layer.
+TEST_F(ProcessRecord, UnownedKeycodesReachActions) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a  = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  pdf    = KeymapKey(0, 1, 0, PDF(1));
+    KeymapKey  key_b  = KeymapKey(1, 0, 0, KC_B);
+    KeymapKey  b_trns = KeymapKey(1, 1, 0, KC_TRNS);
+    set_keymap({key_a, pdf, key_b, b_trns});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    // Persistent default layer keycodes are consumed on release
+    EXPECT_NO_REPORT(driver);
+    tap_key(pdf);
+    EXPECT_EQ(get_highest_layer(default_layer_state), 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    // Restore layer 0 as the default for the following tests
+    default_layer_set(1);
+}
+
+// Observers earlier in the chain see keycodes owned by later ranged handlers.
+TEST_F(ProcessRecord, ObserversSeeRangedKeycodes) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  grave_esc = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+    KeymapKey  lower     = KeymapKey(0, 1, 0, QK_TRI_LAYER_LOWER);
+    set_keymap({grave_esc, lower, KeymapKey(1, 1, 0, KC_TRNS)});
+
+    // Caps Word carries on through layer switches...
+    caps_word_on();
+    EXPECT_NO_REPORT(driver);
+    tap_key(lower);
+    EXPECT_TRUE(is_caps_word_on());
+    VERIFY_AND_CLEAR(driver);
+
+    // ...but ends on any other keycode it doesn't know about
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(grave_esc);
+    EXPECT_FALSE(is_caps_word_on());
+    VERIFY_AND_CLEAR(driver);
+}
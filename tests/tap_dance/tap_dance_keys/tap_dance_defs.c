@@ -0,0 +1,11 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "tap_dance_defs.h"
+
+const tap_dance_action_t tap_dance_actions[] = {
+    [TD_ALL]      = ACTION_TAP_DANCE_KEYS(KC_A, KC_B, KC_C, KC_D),
+    [TD_TAP_HOLD] = ACTION_TAP_DANCE_KEYS(KC_E, KC_F, KC_NO, KC_NO),
+    [TD_PAIR]     = ACTION_TAP_DANCE_DOUBLE(KC_G, KC_H),
+};
@@ -0,0 +1,18 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum tap_dance_ids {
+    TD_ALL,      // ACTION_TAP_DANCE_KEYS(KC_A, KC_B, KC_C, KC_D)
+    TD_TAP_HOLD, // ACTION_TAP_DANCE_KEYS(KC_E, KC_F, KC_NO, KC_NO)
+    TD_PAIR,     // ACTION_TAP_DANCE_DOUBLE(KC_G, KC_H)
+};
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,196 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_keymap_key.hpp"
+#include "tap_dance_defs.h"
+
+using testing::_;
+using testing::InSequence;
+
+// Counts the tap dance key events that went on past process_tap_dance()
+static int passed_on_presses;
+static int passed_on_releases;
+
+extern "C" void post_process_record_user(uint16_t keycode, keyrecord_t *record) {
+    if (IS_QK_TAP_DANCE(keycode)) {
+        (record->event.pressed ? passed_on_presses : passed_on_releases)++;
+    }
+}
+
+class TapDanceKeys : public TestFixture {
+   public:
+    void SetUp() override {
+        passed_on_presses  = 0;
+        passed_on_releases = 0;
+    }
+};
+
+TEST_F(TapDanceKeys, SingleTap) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_td = KeymapKey(0, 1, 0, TD(TD_ALL));
+
+    set_keymap({key_td});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_td);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(tap_dance_get_state(TD_ALL), nullptr);
+}
+
+TEST_F(TapDanceKeys, Hold) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_td = KeymapKey(0, 1, 0, TD(TD_ALL));
+
+    set_keymap({key_td});
+
+    EXPECT_REPORT(driver, (KC_B));
+    key_td.press();
+    idle_for(TAPPING_TERM * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_td.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TapDanceKeys, DoubleTapAndDoubleHold) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_td = KeymapKey(0, 1, 0, TD(TD_ALL));
+
+    set_keymap({key_td});
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_td);
+    tap_key(key_td);
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_D));
+    tap_key(key_td);
+    key_td.press();
+    idle_for(TAPPING_TERM * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_td.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TapDanceKeys, UnconfiguredTapsRepeatTap) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_td = KeymapKey(0, 1, 0, TD(TD_TAP_HOLD));
+
+    set_keymap({key_td});
+
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_td);
+    tap_key(key_td);
+    tap_key(key_td);
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TapDanceKeys, InterruptedHoldIsTap) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_td = KeymapKey(0, 1, 0, TD(TD_TAP_HOLD));
+    auto       key_x  = KeymapKey(0, 2, 0, KC_X);
+
+    set_keymap({key_td, key_x});
+
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_REPORT(driver, (KC_E, KC_X));
+    key_td.press();
+    run_one_scan_loop();
+    key_x.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    key_td.release();
+    run_one_scan_loop();
+    key_x.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TapDanceKeys, KeyPassedOnWhenPoolIsFull) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_all  = KeymapKey(0, 1, 0, TD(TD_ALL));
+    auto       key_hold = KeymapKey(0, 2, 0, TD(TD_TAP_HOLD));
+    auto       key_pair = KeymapKey(0, 3, 0, TD(TD_PAIR));
+
+    set_keymap({key_all, key_hold, key_pair});
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_REPORT(driver, (KC_B, KC_F));
+    key_all.press();
+    idle_for(TAPPING_TERM * 2);
+    key_hold.press();
+    idle_for(TAPPING_TERM * 2);
+    VERIFY_AND_CLEAR(driver);
+    ASSERT_NE(tap_dance_get_state(TD_ALL), nullptr);
+    ASSERT_NE(tap_dance_get_state(TD_TAP_HOLD), nullptr);
+    EXPECT_NE(tap_dance_get_state(TD_ALL), tap_dance_get_state(TD_TAP_HOLD));
+    EXPECT_EQ(tap_dance_get_state(TD_ALL)->index, TD_ALL);
+    EXPECT_EQ(tap_dance_get_state(TD_TAP_HOLD)->index, TD_TAP_HOLD);
+
+    // Both entries of the pool are taken by the held dances, so the third key doesn't start a dance but isn't
+    // swallowed either
+    passed_on_presses  = 0;
+    passed_on_releases = 0;
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_pair);
+    idle_for(TAPPING_TERM * 2);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(tap_dance_get_state(TD_PAIR), nullptr);
+    EXPECT_EQ(passed_on_presses, 1);
+    EXPECT_EQ(passed_on_releases, 1);
+
+    EXPECT_REPORT(driver, (KC_F));
+    EXPECT_EMPTY_REPORT(driver);
+    key_all.release();
+    run_one_scan_loop();
+    key_hold.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(tap_dance_get_state(TD_ALL), nullptr);
+    EXPECT_EQ(tap_dance_get_state(TD_TAP_HOLD), nullptr);
+
+    // Once a dance has reset, its entry can be reused
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_pair);
+    VERIFY_AND_CLEAR(driver);
+    ASSERT_NE(tap_dance_get_state(TD_PAIR), nullptr);
+    EXPECT_EQ(tap_dance_get_state(TD_PAIR)->index, TD_PAIR);
+    EXPECT_EQ(tap_dance_get_state(TD_ALL), nullptr);
+
+    EXPECT_REPORT(driver, (KC_G));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(tap_dance_get_state(TD_PAIR), nullptr);
+}
@@ -9,6 +9,7 @@ SRC += $(CHIBIOS_DIR)/usb_driver.c
 SRC += $(CHIBIOS_DIR)/usb_endpoints.c
 SRC += $(CHIBIOS_DIR)/usb_report_handling.c
 SRC += $(CHIBIOS_DIR)/usb_util.c
+SRC += usb_report_queue.c
 SRC += $(LIBSRC)
 
 VPATH += $(TMK_PATH)/$(PROTOCOL_DIR)
@@ -74,6 +74,148 @@ static void obnotify(io_buffers_queue_t *bqp) {
     }
 }
 
+#if defined(USB_ENDPOINT_IN_STATS)
+/**
+ * @brief   Number of reports waiting to be sent, including the one in flight.
+ *
+ * @param[in] endpoint  the IN endpoint.
+ */
+static size_t usb_endpoint_in_depth_i(usb_endpoint_in_t *endpoint) {
+    size_t depth = bqSizeX(&endpoint->obqueue) - bqSpaceI(&endpoint->obqueue);
+#    if defined(USB_ENDPOINT_IN_NONBLOCKING)
+    depth += endpoint->pending.queue.count;
+#    endif
+    return depth;
+}
+#endif
+
+/**
+ * @brief   Accounts for a report handed over to the endpoint.
+ *
+ * @param[in] endpoint  the IN endpoint.
+ * @param[in] waited    how long the caller waited for room in the queue.
+ */
+static void usb_endpoint_in_submitted_i(usb_endpoint_in_t *endpoint, sysinterval_t waited) {
+#if defined(USB_ENDPOINT_IN_STATS)
+    usb_endpoint_in_stats_t *stats = &endpoint->stats;
+    uint32_t                 wait  = TIME_I2US(waited);
+
+    stats->submitted++;
+    stats->wait_time_us += wait;
+    stats->max_wait_time_us = MAX(stats->max_wait_time_us, wait);
+    stats->max_depth        = MAX(stats->max_depth, usb_endpoint_in_depth_i(endpoint));
+#else
+    (void)endpoint;
+    (void)waited;
+#endif
+}
+
+/**
+ * @brief   Accounts for reports that won't be sent.
+ *
+ * @param[in] endpoint  the IN endpoint.
+ * @param[in] count     the number of reports.
+ */
+static void usb_endpoint_in_dropped_i(usb_endpoint_in_t *endpoint, size_t count) {
+#if defined(USB_ENDPOINT_IN_STATS)
+    endpoint->stats.dropped += count;
+#else
+    (void)endpoint;
+    (void)count;
+#endif
+}
+
+/**
+ * @brief   Discards the held back reports, if any.
+ *
+ * @param[in] endpoint  the IN endpoint.
+ */
+static void usb_endpoint_in_reset_pending_i(usb_endpoint_in_t *endpoint) {
+#if defined(USB_ENDPOINT_IN_NONBLOCKING)
+    usb_endpoint_in_pending_t *pending = &endpoint->pending;
+    usb_endpoint_in_dropped_i(endpoint, pending->queue.count);
+    usb_report_queue_clear(&pending->queue);
+    pending->queued_ahead = 0;
+    pending->in_flight    = false;
+    osalThreadResumeI(&pending->waiting, MSG_RESET);
+#else
+    (void)endpoint;
+#endif
+}
+
+/**
+ * @brief   Accounts for a queued report having been sent.
+ *
+ * @param[in] endpoint  the IN endpoint.
+ */
+static void usb_endpoint_in_advance_pending_i(usb_endpoint_in_t *endpoint) {
+#if defined(USB_ENDPOINT_IN_NONBLOCKING)
+    if (endpoint->pending.queued_ahead > 0U) {
+        endpoint->pending.queued_ahead--;
+    }
+#else
+    (void)endpoint;
+#endif
+}
+
+/**
+ * @brief   Releases the oldest held back report if it is the one just
+ *          transmitted, making room for a waiting sender.
+ *
+ * @param[in] endpoint  the IN endpoint.
+ * @return              true if the transmitted report was a held back one.
+ */
+static bool usb_endpoint_in_release_pending_i(usb_endpoint_in_t *endpoint) {
+#if defined(USB_ENDPOINT_IN_NONBLOCKING)
+    usb_endpoint_in_pending_t *pending = &endpoint->pending;
+    if (!pending->in_flight) {
+        return false;
+    }
+
+    uint8_t  size;
+    uint8_t *data = usb_report_queue_peek(&pending->queue, &size);
+    if (data != NULL && endpoint->report_storage != NULL) {
+        endpoint->report_storage->set_report(endpoint->report_storage->reports, data, size);
+    }
+    usb_report_queue_pop(&pending->queue);
+    pending->in_flight = false;
+    osalThreadResumeI(&pending->waiting, MSG_OK);
+    return true;
+#else
+    (void)endpoint;
+    return false;
+#endif
+}
+
+/**
+ * @brief   Starts transmitting the oldest held back report, once the reports
+ *          queued before it have been sent.
+ *
+ * @param[in] endpoint  the IN endpoint.
+ * @return              true if a transmission was started.
+ */
+static bool usb_endpoint_in_transmit_pending_i(usb_endpoint_in_t *endpoint) {
+#if defined(USB_ENDPOINT_IN_NONBLOCKING)
+    usb_endpoint_in_pending_t *pending = &endpoint->pending;
+    if (pending->queued_ahead > 0U || pending->in_flight) {
+        return false;
+    }
+
+    uint8_t  size;
+    uint8_t *data = usb_report_queue_peek(&pending->queue, &size);
+    if (data == NULL) {
+        return false;
+    }
+
+    pending->in_flight = true;
+    usbStartTransmitI(endpoint->config.usbp, endpoint->config.ep, data, size);
+    return true;
+#else
+    (void)endpoint;
+    return false;
+#endif
+}
+
 /*===========================================================================*/
 /* Driver exported functions.                                                */
 /*===========================================================================*/
@@ -124,6 +266,7 @@ void usb_endpoint_in_stop(usb_endpoint_in_t *endpoint) {
 
     bqSuspendI(&endpoint->obqueue);
     obqResetI(&endpoint->obqueue);
+    usb_endpoint_in_reset_pending_i(endpoint);
     if (endpoint->report_storage != NULL) {
         endpoint->report_storage->reset_report(endpoint->report_storage->reports);
     }
@@ -146,6 +289,7 @@ void usb_endpoint_out_stop(usb_endpoint_out_t *endpoint) {
 void usb_endpoint_in_suspend_cb(usb_endpoint_in_t *endpoint) {
     bqSuspendI(&endpoint->obqueue);
     obqResetI(&endpoint->obqueue);
+    usb_endpoint_in_reset_pending_i(endpoint);
 
     if (endpoint->report_storage != NULL) {
         endpoint->report_storage->reset_report(endpoint->report_storage->reports);
@@ -168,6 +312,7 @@ void usb_endpoint_out_wakeup_cb(usb_endpoint_out_t *endpoint) {
 void usb_endpoint_in_configure_cb(usb_endpoint_in_t *endpoint) {
     usbInitEndpointI(endpoint->config.usbp, endpoint->config.ep, &endpoint->ep_config);
     obqResetI(&endpoint->obqueue);
+    usb_endpoint_in_reset_pending_i(endpoint);
     bqResumeX(&endpoint->obqueue);
 }
 
@@ -197,8 +342,9 @@ void usb_endpoint_in_tx_complete_cb(USBDriver *usbp, usbep_t ep) {
     /* Sending succeded, so we can reset the timed out state. */
     endpoint->timed_out = false;
 
-    /* Freeing the buffer just transmitted, if it was not a zero size packet.*/
-    if (!obqIsEmptyI(&endpoint->obqueue) && usbp->epc[ep]->in_state->txsize > 0U) {
+    /* Freeing the buffer just transmitted, if it was not a zero size packet
+     * or a held back report, which doesn't live in the queue.*/
+    if (!usb_endpoint_in_release_pending_i(endpoint) && !obqIsEmptyI(&endpoint->obqueue) && usbp->epc[ep]->in_state->txsize > 0U) {
         /* Store the last send report in the endpoint to be retrieved by a
          * GET_REPORT request or IDLE report handling. */
         if (endpoint->report_storage != NULL) {
@@ -206,14 +352,17 @@ void usb_endpoint_in_tx_complete_cb(USBDriver *usbp, usbep_t ep) {
             endpoint->report_storage->set_report(endpoint->report_storage->reports, buffer, n);
         }
         obqReleaseEmptyBufferI(&endpoint->obqueue);
+        usb_endpoint_in_advance_pending_i(endpoint);
     }
 
     /* Checking if there is a buffer ready for transmission.*/
     buffer = obqGetFullBufferI(&endpoint->obqueue, &n);
 
-    if (buffer != NULL) {
-        /* The endpoint cannot be busy, we are in the context of the callback,
-           so it is safe to transmit without a check.*/
+    /* The endpoint cannot be busy, we are in the context of the callback,
+       so it is safe to transmit without a check.*/
+    if (usb_endpoint_in_transmit_pending_i(endpoint)) {
+        /* The reports held back while the queue was full go next.*/
+    } else if (buffer != NULL) {
         usbStartTransmitI(usbp, ep, buffer, n);
     } else if ((usbp->epc[ep]->ep_mode == USB_EP_MODE_TYPE_BULK) && (usbp->epc[ep]->in_state->txsize > 0U) && ((usbp->epc[ep]->in_state->txsize & ((size_t)usbp->epc[ep]->in_maxsize - 1U)) == 0U)) {
         /* Transmit zero sized packet in case the last one has maximum allowed
@@ -269,14 +418,20 @@ bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size
     }
     osalSysUnlock();
 
+    systime_t start = chVTGetSystemTimeX();
+
     while (true) {
         size_t sent = obqWriteTimeout(&endpoint->obqueue, data, size, timeout);
 
         if (sent < size) {
             osalSysLock();
             endpoint->timed_out |= sent == 0;
+            usb_endpoint_in_dropped_i(endpoint, bqSizeX(&endpoint->obqueue) - bqSpaceI(&endpoint->obqueue));
             bqSuspendI(&endpoint->obqueue);
             obqResetI(&endpoint->obqueue);
+#if defined(USB_ENDPOINT_IN_NONBLOCKING)
+            endpoint->pending.queued_ahead = 0;
+#endif
             bqResumeX(&endpoint->obqueue);
             osalOsRescheduleS();
             osalSysUnlock();
@@ -287,10 +442,76 @@ bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size
             obqFlush(&endpoint->obqueue);
         }
 
+        osalSysLock();
+        usb_endpoint_in_submitted_i(endpoint, chTimeDiffX(start, chVTGetSystemTimeX()));
+        osalSysUnlock();
+
         return true;
     }
 }
 
+#if defined(USB_ENDPOINT_IN_NONBLOCKING)
+/* Like usb_endpoint_in_send, but rather than waiting for room in a full queue,
+ * the report is held back and transmitted from the transfer complete callback
+ * once the reports queued before it have been sent. Up to
+ * USB_ENDPOINT_IN_HOLD_CAPACITY reports are held back, in order, and only
+ * `merge` may combine a report with the last one held back, where that loses
+ * nothing. Once they are all taken, this waits for one of them to be sent.
+ *
+ * While any report is held back, later ones are held back as well, so that
+ * they can't overtake it. */
+bool usb_endpoint_in_send_or_hold(usb_endpoint_in_t *endpoint, const uint8_t *data, size_t size, usb_report_merge_t merge, sysinterval_t timeout) {
+    osalDbgCheck((endpoint != NULL) && (data != NULL) && (size > 0U) && (size <= endpoint->config.buffer_size));
+
+    usb_endpoint_in_pending_t *pending = &endpoint->pending;
+    systime_t                  start   = chVTGetSystemTimeX();
+
+    osalSysLock();
+    /* Don't wait for an endpoint nobody is listening on, see usb_endpoint_in_send.*/
+    if (endpoint->timed_out && timeout != TIME_INFINITE) {
+        timeout = TIME_IMMEDIATE;
+    }
+
+    while (true) {
+        if (usbGetDriverStateI(endpoint->config.usbp) != USB_ACTIVE) {
+            osalSysUnlock();
+            return false;
+        }
+
+        /* Only the transfer complete callback takes buffers out of the queue,
+         * so if there is room now, there still is once the lock is released.*/
+        if (usb_report_queue_is_empty(&pending->queue) && bqSpaceI(&endpoint->obqueue) > 0U) {
+            break;
+        }
+
+        /* The queue is full, or already has reports held back behind it, so
+         * something is being transmitted and the transfer complete callback is
+         * bound to pick the held back reports up. The one being transmitted
+         * must not change anymore.*/
+        bool was_empty  = usb_report_queue_is_empty(&pending->queue);
+        bool merge_last = !(pending->in_flight && pending->queue.count == 1U);
+        if (usb_report_queue_push(&pending->queue, data, size, merge, merge_last)) {
+            if (was_empty) {
+                pending->queued_ahead = bqSizeX(&endpoint->obqueue);
+            }
+            usb_endpoint_in_submitted_i(endpoint, chTimeDiffX(start, chVTGetSystemTimeX()));
+            osalSysUnlock();
+            return true;
+        }
+
+        if (osalThreadSuspendTimeoutS(&pending->waiting, timeout) == MSG_TIMEOUT) {
+            endpoint->timed_out = true;
+            usb_endpoint_in_dropped_i(endpoint, 1);
+            osalSysUnlock();
+            return false;
+        }
+    }
+    osalSysUnlock();
+
+    return usb_endpoint_in_send(endpoint, data, size, TIME_IMMEDIATE, false);
+}
+#endif
+
 void usb_endpoint_in_flush(usb_endpoint_in_t *endpoint, bool padded) {
     osalDbgCheck(endpoint != NULL);
 
@@ -315,18 +536,46 @@ bool usb_endpoint_in_is_inactive(usb_endpoint_in_t *endpoint) {
 
     osalSysLock();
     bool inactive = obqIsEmptyI(&endpoint->obqueue) && !usbGetTransmitStatusI(endpoint->config.usbp, endpoint->config.ep);
+#if defined(USB_ENDPOINT_IN_NONBLOCKING)
+    inactive &= usb_report_queue_is_empty(&endpoint->pending.queue);
+#endif
     osalSysUnlock();
 
     return inactive;
 }
 
+#if defined(USB_ENDPOINT_IN_STATS)
+void usb_endpoint_in_get_stats(usb_endpoint_in_t *endpoint, usb_endpoint_in_stats_t *stats) {
+    osalDbgCheck((endpoint != NULL) && (stats != NULL));
+
+    osalSysLock();
+    *stats       = endpoint->stats;
+    stats->depth = usb_endpoint_in_depth_i(endpoint);
+    osalSysUnlock();
+}
+
+void usb_endpoint_in_reset_stats(usb_endpoint_in_t *endpoint) {
+    osalDbgCheck(endpoint != NULL);
+
+    osalSysLock();
+    endpoint->stats = (usb_endpoint_in_stats_t){0};
+    osalSysUnlock();
+}
+#endif
+
 bool usb_endpoint_out_receive(usb_endpoint_out_t *endpoint, uint8_t *data, size_t size, sysinterval_t timeout) {
+    return usb_endpoint_out_read(endpoint, data, size, timeout) == size;
+}
+
+/* Like usb_endpoint_out_receive, but also hands over fewer bytes than asked for
+ * if that's all there is, which lets callers drain several packets in one go. */
+size_t usb_endpoint_out_read(usb_endpoint_out_t *endpoint, uint8_t *data, size_t size, sysinterval_t timeout) {
     osalDbgCheck((endpoint != NULL) && (data != NULL) && (size > 0U));
 
     osalSysLock();
     if (usbGetDriverStateI(endpoint->config.usbp) != USB_ACTIVE) {
         osalSysUnlock();
-        return false;
+        return 0;
     }
 
     if (endpoint->timed_out && timeout != TIME_INFINITE) {
@@ -337,5 +586,5 @@ bool usb_endpoint_out_receive(usb_endpoint_out_t *endpoint, uint8_t *data, size_
     const size_t received = ibqReadTimeout(&endpoint->ibqueue, data, size, timeout);
     endpoint->timed_out   = received == 0;
 
-    return received == size;
+    return received;
 }
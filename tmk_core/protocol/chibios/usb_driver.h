@@ -12,6 +12,7 @@
 #include "usb_report_handling.h"
 #include "string.h"
 #include "timer.h"
+#include "usb_report_queue.h"
 
 #if HAL_USE_USB == FALSE
 #    error "The USB Driver requires HAL_USE_USB"
@@ -24,6 +25,16 @@
             NULL, /* SETUP buffer (not a SETUP endpoint) */
 #endif
 
+/* Storage for the reports held back while the IN queue is full, see usb_endpoint_in_send_or_hold */
+#if defined(USB_ENDPOINT_IN_NONBLOCKING)
+#    if !defined(USB_ENDPOINT_IN_HOLD_CAPACITY)
+#        define USB_ENDPOINT_IN_HOLD_CAPACITY 4
+#    endif
+#    define QMK_USB_ENDPOINT_IN_PENDING(ep_size) .pending = {.queue = USB_REPORT_QUEUE(ep_size, USB_ENDPOINT_IN_HOLD_CAPACITY)},
+#else
+#    define QMK_USB_ENDPOINT_IN_PENDING(ep_size)
+#endif
+
 /*
  * Implementation notes:
  *
@@ -36,6 +47,7 @@
 #define QMK_USB_ENDPOINT_IN(mode, ep_size, ep_num, _buffer_capacity, _usb_requests_cb, _report_storage) \
     {                                                                                                   \
         .usb_requests_cb = _usb_requests_cb, .report_storage = _report_storage,                         \
+        QMK_USB_ENDPOINT_IN_PENDING(ep_size)                                                            \
         .ep_config =                                                                                    \
             {                                                                                           \
                 mode,                           /* EP Mode */                                           \
@@ -87,6 +99,7 @@
 #    define QMK_USB_ENDPOINT_IN_SHARED(mode, ep_size, ep_num, _buffer_capacity, _usb_requests_cb, _report_storage) \
         {                                                                                                          \
             .usb_requests_cb = _usb_requests_cb, .is_shared = true, .report_storage = _report_storage,             \
+            QMK_USB_ENDPOINT_IN_PENDING(ep_size)                                                                   \
             .ep_config =                                                                                           \
                 {                                                                                                  \
                     mode,                            /* EP Mode */                                                 \
@@ -154,6 +167,56 @@ typedef struct {
     uint8_t *buffer;
 } usb_endpoint_config_t;
 
+#if defined(USB_ENDPOINT_IN_NONBLOCKING)
+typedef struct {
+    /**
+     * @brief Reports held back while the queue was full, in the order they were sent
+     */
+    usb_report_queue_t queue;
+
+    /**
+     * @brief Number of queued reports which have to be sent before them
+     */
+    uint8_t queued_ahead;
+
+    /**
+     * @brief Whether the oldest held back report is being transmitted
+     */
+    bool in_flight;
+
+    /**
+     * @brief Thread waiting for room to hold back another report
+     */
+    thread_reference_t waiting;
+} usb_endpoint_in_pending_t;
+#endif
+
+#if defined(USB_ENDPOINT_IN_STATS)
+typedef struct {
+    /**
+     * @brief Reports handed over to the endpoint
+     */
+    uint32_t submitted;
+
+    /**
+     * @brief Reports discarded before they could be sent
+     */
+    uint32_t dropped;
+
+    /**
+     * @brief Total and longest time spent waiting for room in the queue, in microseconds
+     */
+    uint32_t wait_time_us;
+    uint32_t max_wait_time_us;
+
+    /**
+     * @brief Current and highest number of reports waiting to be sent
+     */
+    uint8_t depth;
+    uint8_t max_depth;
+} usb_endpoint_in_stats_t;
+#endif
+
 typedef struct {
     output_buffers_queue_t obqueue;
     USBEndpointConfig      ep_config;
@@ -166,6 +229,12 @@ typedef struct {
     usbreqhandler_t       usb_requests_cb;
     bool                  timed_out;
     usb_report_storage_t *report_storage;
+#if defined(USB_ENDPOINT_IN_NONBLOCKING)
+    usb_endpoint_in_pending_t pending;
+#endif
+#if defined(USB_ENDPOINT_IN_STATS)
+    usb_endpoint_in_stats_t stats;
+#endif
 } usb_endpoint_in_t;
 
 typedef struct {
@@ -185,8 +254,15 @@ void usb_endpoint_in_start(usb_endpoint_in_t *endpoint);
 void usb_endpoint_in_stop(usb_endpoint_in_t *endpoint);
 
 bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size_t size, sysinterval_t timeout, bool buffered);
+#if defined(USB_ENDPOINT_IN_NONBLOCKING)
+bool usb_endpoint_in_send_or_hold(usb_endpoint_in_t *endpoint, const uint8_t *data, size_t size, usb_report_merge_t merge, sysinterval_t timeout);
+#endif
 void usb_endpoint_in_flush(usb_endpoint_in_t *endpoint, bool padded);
 bool usb_endpoint_in_is_inactive(usb_endpoint_in_t *endpoint);
+#if defined(USB_ENDPOINT_IN_STATS)
+void usb_endpoint_in_get_stats(usb_endpoint_in_t *endpoint, usb_endpoint_in_stats_t *stats);
+void usb_endpoint_in_reset_stats(usb_endpoint_in_t *endpoint);
+#endif
 
 void usb_endpoint_in_suspend_cb(usb_endpoint_in_t *endpoint);
 void usb_endpoint_in_wakeup_cb(usb_endpoint_in_t *endpoint);
@@ -197,7 +273,8 @@ void usb_endpoint_out_init(usb_endpoint_out_t *endpoint);
 void usb_endpoint_out_start(usb_endpoint_out_t *endpoint);
 void usb_endpoint_out_stop(usb_endpoint_out_t *endpoint);
 
-bool usb_endpoint_out_receive(usb_endpoint_out_t *endpoint, uint8_t *data, size_t size, sysinterval_t timeout);
+bool   usb_endpoint_out_receive(usb_endpoint_out_t *endpoint, uint8_t *data, size_t size, sysinterval_t timeout);
+size_t usb_endpoint_out_read(usb_endpoint_out_t *endpoint, uint8_t *data, size_t size, sysinterval_t timeout);
 
 void usb_endpoint_out_suspend_cb(usb_endpoint_out_t *endpoint);
 void usb_endpoint_out_wakeup_cb(usb_endpoint_out_t *endpoint);
@@ -31,6 +31,7 @@
 #include "usb_descriptor.h"
 #include "usb_driver.h"
 #include "usb_types.h"
+#include "util.h"
 
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
@@ -401,6 +402,26 @@ bool send_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size) {
     return usb_endpoint_in_send(&usb_endpoints_in[endpoint], (uint8_t *)report, size, TIME_MS2I(100), false);
 }
 
+#if defined(USB_ENDPOINT_IN_NONBLOCKING)
+/**
+ * @brief Send a report carrying the state of an input to the host. With
+ * USB_ENDPOINT_IN_NONBLOCKING defined, this doesn't wait for a full endpoint
+ * queue to make room, but holds the report back to be sent once it drains.
+ *
+ * @param endpoint USB IN endpoint to send the report from
+ * @param report pointer to the report
+ * @param size size of the report
+ * @param merge combines the report with the last one held back, may be NULL
+ * @return true Success
+ * @return false Failure
+ */
+static bool send_state_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size, usb_report_merge_t merge) {
+    return usb_endpoint_in_send_or_hold(&usb_endpoints_in[endpoint], (uint8_t *)report, size, merge, TIME_MS2I(100));
+}
+#else
+#    define send_state_report(endpoint, report, size, merge) send_report(endpoint, report, size)
+#endif
+
 /**
  * @brief Send a report to the host, but delay the sending until the size of
  * endpoint report is reached or the incompletely filled buffer is flushed with
@@ -445,15 +466,15 @@ static bool receive_report(usb_endpoint_out_lut_t endpoint, void *report, size_t
 void send_keyboard(report_keyboard_t *report) {
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (usb_device_state_get_protocol() == USB_PROTOCOL_BOOT) {
-        send_report(USB_ENDPOINT_IN_KEYBOARD, &report->mods, 8);
+        send_state_report(USB_ENDPOINT_IN_KEYBOARD, &report->mods, 8, NULL);
     } else {
-        send_report(USB_ENDPOINT_IN_KEYBOARD, report, KEYBOARD_REPORT_SIZE);
+        send_state_report(USB_ENDPOINT_IN_KEYBOARD, report, KEYBOARD_REPORT_SIZE, NULL);
     }
 }
 
 void send_nkro(report_nkro_t *report) {
 #ifdef NKRO_ENABLE
-    send_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_nkro_t));
+    send_state_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_nkro_t), NULL);
 #endif
 }
 
@@ -462,9 +483,18 @@ void send_nkro(report_nkro_t *report) {
  * ---------------------------------------------------------
  */
 
+#if defined(MOUSE_ENABLE) && defined(USB_ENDPOINT_IN_NONBLOCKING)
+/* Mouse reports held back with the same buttons have their movement added up,
+ * keyboard and other reports are only ever held back as they are. */
+static bool merge_mouse(uint8_t *into, const uint8_t *report, uint8_t size) {
+    (void)size;
+    return merge_mouse_report((report_mouse_t *)into, (const report_mouse_t *)report);
+}
+#endif
+
 void send_mouse(report_mouse_t *report) {
 #ifdef MOUSE_ENABLE
-    send_report(USB_ENDPOINT_IN_MOUSE, report, sizeof(report_mouse_t));
+    send_state_report(USB_ENDPOINT_IN_MOUSE, report, sizeof(report_mouse_t), merge_mouse);
 #endif
 }
 
@@ -475,25 +505,25 @@ void send_mouse(report_mouse_t *report) {
 
 void send_extra(report_extra_t *report) {
 #ifdef EXTRAKEY_ENABLE
-    send_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_extra_t));
+    send_state_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_extra_t), NULL);
 #endif
 }
 
 void send_programmable_button(report_programmable_button_t *report) {
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-    send_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_programmable_button_t));
+    send_state_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_programmable_button_t), NULL);
 #endif
 }
 
 void send_joystick(report_joystick_t *report) {
 #ifdef JOYSTICK_ENABLE
-    send_report(USB_ENDPOINT_IN_JOYSTICK, report, sizeof(report_joystick_t));
+    send_state_report(USB_ENDPOINT_IN_JOYSTICK, report, sizeof(report_joystick_t), NULL);
 #endif
 }
 
 void send_digitizer(report_digitizer_t *report) {
 #ifdef DIGITIZER_ENABLE
-    send_report(USB_ENDPOINT_IN_DIGITIZER, report, sizeof(report_digitizer_t));
+    send_state_report(USB_ENDPOINT_IN_DIGITIZER, report, sizeof(report_digitizer_t), NULL);
 #endif
 }
 
@@ -547,6 +577,25 @@ bool recv_midi_packet(MIDI_EventPacket_t *const event) {
     return receive_report(USB_ENDPOINT_OUT_MIDI, (uint8_t *)event, sizeof(MIDI_EventPacket_t));
 }
 
+void send_midi_packets(MIDI_EventPacket_t *events, uint8_t count) {
+    uint8_t *data = (uint8_t *)events;
+    size_t   size = count * sizeof(MIDI_EventPacket_t);
+
+    // Fill whole USB buffers, rather than sending a transfer per event
+    while (size > 0) {
+        size_t chunk = MIN(size, MIDI_STREAM_EPSIZE);
+        send_report_buffered(USB_ENDPOINT_IN_MIDI, data, chunk);
+        data += chunk;
+        size -= chunk;
+    }
+    flush_report_buffered(USB_ENDPOINT_IN_MIDI, false);
+}
+
+uint8_t recv_midi_packets(MIDI_EventPacket_t *const events, uint8_t count) {
+    size_t received = usb_endpoint_out_read(&usb_endpoints_out[USB_ENDPOINT_OUT_MIDI], (uint8_t *)events, count * sizeof(MIDI_EventPacket_t), TIME_IMMEDIATE);
+    return received / sizeof(MIDI_EventPacket_t);
+}
+
 #endif
 
 #ifdef VIRTSER_ENABLE
@@ -681,6 +681,22 @@ bool recv_midi_packet(MIDI_EventPacket_t *const event) {
     return MIDI_Device_ReceiveEventPacket(&USB_MIDI_Interface, event);
 }
 
+void send_midi_packets(MIDI_EventPacket_t *events, uint8_t count) {
+    // LUFA only sends the endpoint bank once it is full, or on flush
+    for (uint8_t i = 0; i < count; i++) {
+        MIDI_Device_SendEventPacket(&USB_MIDI_Interface, &events[i]);
+    }
+    MIDI_Device_Flush(&USB_MIDI_Interface);
+}
+
+uint8_t recv_midi_packets(MIDI_EventPacket_t *const events, uint8_t count) {
+    uint8_t received = 0;
+    while (received < count && MIDI_Device_ReceiveEventPacket(&USB_MIDI_Interface, &events[received])) {
+        received++;
+    }
+    return received;
+}
+
 #endif
 
 /*******************************************************************************
@@ -21,38 +21,56 @@
 #include "debug.h"
 #include "usb_device_state.h"
 #include "util.h"
+#include "bitwise.h"
 #include <string.h>
 
+/* Keys held in the global reports, kept up to date as keys are added and
+ * removed, so that the queries below don't have to scan the reports. */
+static uint8_t keyboard_report_key_count = 0;
+#ifdef NKRO_ENABLE
+_Static_assert(NKRO_REPORT_BITS <= 32, "NKRO occupancy doesn't fit in 32 bits");
+
+static uint8_t nkro_report_key_count = 0;
+// Bit n is set if any key is set in nkro_report->bits[n]
+static uint32_t nkro_report_occupancy = 0;
+#endif
+
+static inline bool is_global_keyboard_report(const report_keyboard_t* report) {
+    return report == keyboard_report;
+}
+
+#ifdef NKRO_ENABLE
+static inline bool is_global_nkro_report(const report_nkro_t* report) {
+    return report == nkro_report;
+}
+#endif
+
 /** \brief has_anykey
  *
- * FIXME: Needs doc
+ * Returns the number of keys pressed in the current report, not counting modifiers.
  */
 uint8_t has_anykey(void) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        p  = nkro_report->bits;
-        lp = sizeof(nkro_report->bits);
+        return nkro_report_key_count;
     }
 #endif
-    while (lp--) {
-        if (*p++) cnt++;
-    }
-    return cnt;
+    return keyboard_report_key_count;
 }
 
 /** \brief get_first_key
  *
- * FIXME: Needs doc
+ * Returns a key pressed in the current report. For NKRO, this is the highest key
+ * of the lowest byte of the bitmap with any key, or KC_NO if there is none. For
+ * 6KRO, this is the first slot of the report, which may be empty.
  */
 uint8_t get_first_key(void) {
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        uint8_t i = 0;
-        for (; i < NKRO_REPORT_BITS && !nkro_report->bits[i]; i++)
-            ;
+        if (nkro_report_occupancy == 0) {
+            return KC_NO;
+        }
+        uint8_t i = biton32(nkro_report_occupancy & -nkro_report_occupancy);
         return i << 3 | biton(nkro_report->bits[i]);
     }
 #endif
@@ -77,6 +95,9 @@ bool is_key_pressed(uint8_t key) {
         }
     }
 #endif
+    if (keyboard_report_key_count == 0) {
+        return false;
+    }
     for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
         if (keyboard_report->keys[i] == key) {
             return true;
@@ -87,7 +108,7 @@ bool is_key_pressed(uint8_t key) {
 
 /** \brief add key byte
  *
- * FIXME: Needs doc
+ * Adds a key to a 6KRO report, unless it is already there or the report is full.
  */
 void add_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
     int8_t i     = 0;
@@ -103,18 +124,24 @@ void add_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
     if (i == KEYBOARD_REPORT_KEYS) {
         if (empty != -1) {
             keyboard_report->keys[empty] = code;
+            if (is_global_keyboard_report(keyboard_report)) {
+                keyboard_report_key_count++;
+            }
         }
     }
 }
 
 /** \brief del key byte
  *
- * FIXME: Needs doc
+ * Removes a key from a 6KRO report.
  */
 void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
     for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
         if (keyboard_report->keys[i] == code) {
             keyboard_report->keys[i] = 0;
+            if (is_global_keyboard_report(keyboard_report) && code != 0) {
+                keyboard_report_key_count--;
+            }
         }
     }
 }
@@ -122,11 +149,18 @@ void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
 #ifdef NKRO_ENABLE
 /** \brief add key bit
  *
- * FIXME: Needs doc
+ * Adds a key to an NKRO report.
  */
 void add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
-        nkro_report->bits[code >> 3] |= 1 << (code & 7);
+        uint8_t mask = 1 << (code & 7);
+        if (!(nkro_report->bits[code >> 3] & mask)) {
+            nkro_report->bits[code >> 3] |= mask;
+            if (is_global_nkro_report(nkro_report)) {
+                nkro_report_key_count++;
+                nkro_report_occupancy |= (uint32_t)1 << (code >> 3);
+            }
+        }
     } else {
         dprintf("add_key_bit: can't add: %02X\n", code);
     }
@@ -134,11 +168,20 @@ void add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
 
 /** \brief del key bit
  *
- * FIXME: Needs doc
+ * Removes a key from an NKRO report.
  */
 void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
-        nkro_report->bits[code >> 3] &= ~(1 << (code & 7));
+        uint8_t mask = 1 << (code & 7);
+        if (nkro_report->bits[code >> 3] & mask) {
+            nkro_report->bits[code >> 3] &= ~mask;
+            if (is_global_nkro_report(nkro_report)) {
+                nkro_report_key_count--;
+                if (nkro_report->bits[code >> 3] == 0) {
+                    nkro_report_occupancy &= ~((uint32_t)1 << (code >> 3));
+                }
+            }
+        }
     } else {
         dprintf("del_key_bit: can't del: %02X\n", code);
     }
@@ -182,10 +225,13 @@ void clear_keys_from_report(void) {
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
         memset(nkro_report->bits, 0, sizeof(nkro_report->bits));
+        nkro_report_key_count = 0;
+        nkro_report_occupancy = 0;
         return;
     }
 #endif
     memset(keyboard_report->keys, 0, sizeof(keyboard_report->keys));
+    keyboard_report_key_count = 0;
 }
 
 #ifdef MOUSE_ENABLE
@@ -207,4 +253,44 @@ __attribute__((weak)) bool has_mouse_report_changed(report_mouse_t* new_report,
                     (new_report->x != 0 && new_report->x != old_report->x) || (new_report->y != 0 && new_report->y != old_report->y) || (new_report->h != 0 && new_report->h != old_report->h) || (new_report->v != 0 && new_report->v != old_report->v));
     return changed;
 }
+
+// The report descriptor limits deltas to -127..127, or -32767..32767 for 16 bit fields
+static bool mouse_delta_fits(int32_t value, size_t size) {
+    int32_t max = size == 2 ? INT16_MAX : INT8_MAX;
+    return value >= -max && value <= max;
+}
+
+/**
+ * @brief Adds the movement of a mouse report to an earlier one that hasn't
+ * been sent yet. Reports with different buttons, or whose movement doesn't fit
+ * in one report, are left alone, so that no click or motion is lost.
+ *
+ * @param[in,out] into report_mouse_t the earlier report
+ * @param[in] report report_mouse_t the newer report
+ * @return bool whether the newer report was merged
+ */
+bool merge_mouse_report(report_mouse_t* into, const report_mouse_t* report) {
+    int32_t x = into->x + report->x;
+    int32_t y = into->y + report->y;
+    int32_t v = into->v + report->v;
+    int32_t h = into->h + report->h;
+
+    if (into->buttons != report->buttons ||
+#    ifdef MOUSE_SHARED_EP
+        into->report_id != report->report_id ||
+#    endif
+        !mouse_delta_fits(x, sizeof(mouse_xy_report_t)) || !mouse_delta_fits(y, sizeof(mouse_xy_report_t)) || !mouse_delta_fits(v, sizeof(mouse_hv_report_t)) || !mouse_delta_fits(h, sizeof(mouse_hv_report_t))) {
+        return false;
+    }
+
+    into->x = x;
+    into->y = y;
+    into->v = v;
+    into->h = h;
+#    ifdef MOUSE_EXTENDED_REPORT
+    into->boot_x = (x > 127) ? 127 : ((x < -127) ? -127 : x);
+    into->boot_y = (y > 127) ? 127 : ((y < -127) ? -127 : y);
+#    endif
+    return true;
+}
 #endif
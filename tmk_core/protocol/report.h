@@ -349,6 +349,7 @@ void clear_keys_from_report(void);
 
 #ifdef MOUSE_ENABLE
 bool has_mouse_report_changed(report_mouse_t* new_report, report_mouse_t* old_report);
+bool merge_mouse_report(report_mouse_t* into, const report_mouse_t* report);
 #endif
 
 #ifdef __cplusplus
@@ -0,0 +1,264 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * Host simulator protocol.
+ *
+ * Replaces the USB stack and the main loop of the firmware, so that a keymap
+ * built against the test platform runs as a regular executable. A trace of
+ * matrix events is replayed one millisecond scan at a time, and every report
+ * the firmware sends is printed, along with how much CPU time the host spent
+ * handling each event.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "keyboard.h"
+#include "host.h"
+#include "matrix.h"
+#include "timer.h"
+#include "sendchar.h"
+#include "util.h"
+
+// The records hold format string addresses of a 32-bit firmware image, which qmk console-decode can't resolve in a
+// host executable
+#ifdef DEFERRED_PRINT_ENABLE
+#    error "Deferred printing is not supported with PROTOCOL = sim"
+#endif
+
+#ifndef SIM_TRAILING_MS
+#    define SIM_TRAILING_MS 1000
+#endif
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+
+void platform_setup(void);
+void protocol_keyboard_task(void);
+
+static matrix_row_t sim_matrix[MATRIX_ROWS];
+static bool         sim_matrix_changed = false;
+
+/* Matrix */
+
+void matrix_init_custom(void) {
+    memset(sim_matrix, 0, sizeof(sim_matrix));
+}
+
+bool matrix_scan_custom(matrix_row_t current_matrix[]) {
+    bool changed = sim_matrix_changed;
+    memcpy(current_matrix, sim_matrix, sizeof(sim_matrix));
+    sim_matrix_changed = false;
+    return changed;
+}
+
+/* Host driver */
+
+static void print_report(const char *kind, const void *report, size_t size) {
+    const uint8_t *bytes = report;
+    printf("%" PRIu32 " report %s", timer_read32(), kind);
+    for (size_t i = 0; i < size; i++) {
+        printf(" %02X", bytes[i]);
+    }
+    printf("\n");
+}
+
+static uint8_t sim_keyboard_leds(void) {
+    return 0;
+}
+
+static void sim_send_keyboard(report_keyboard_t *report) {
+    print_report("keyboard", report, sizeof(report_keyboard_t));
+}
+
+static void sim_send_nkro(report_nkro_t *report) {
+    print_report("nkro", report, sizeof(report_nkro_t));
+}
+
+static void sim_send_mouse(report_mouse_t *report) {
+    print_report("mouse", report, sizeof(report_mouse_t));
+}
+
+static void sim_send_extra(report_extra_t *report) {
+    print_report("extra", report, sizeof(report_extra_t));
+}
+
+void send_digitizer(report_digitizer_t *report) {
+    print_report("digitizer", report, sizeof(report_digitizer_t));
+}
+
+void send_programmable_button(report_programmable_button_t *report) {
+    print_report("programmable_button", report, sizeof(report_programmable_button_t));
+}
+
+static host_driver_t sim_driver = {sim_keyboard_leds, sim_send_keyboard, sim_send_nkro, sim_send_mouse, sim_send_extra};
+
+// Keeps debug output apart from the reports
+int8_t sendchar(uint8_t c) {
+    fputc(c, stderr);
+    return 0;
+}
+
+#ifdef CONSOLE_ENABLE
+// Output goes straight through sendchar, so there is nothing to flush
+void console_task(void) {}
+#endif
+
+/* Protocol */
+
+void protocol_setup(void) {}
+
+void protocol_pre_init(void) {}
+
+void protocol_post_init(void) {
+    host_set_driver(&sim_driver);
+}
+
+void protocol_pre_task(void) {}
+
+void protocol_post_task(void) {}
+
+/* Trace replay */
+
+typedef struct {
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint32_t scans;
+} sim_stats_t;
+
+static uint64_t cpu_time_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+// Mirrors a single iteration of the firmware's main loop
+static void sim_scan(sim_stats_t *stats) {
+    uint64_t start = cpu_time_ns();
+
+    protocol_pre_task();
+    protocol_keyboard_task();
+    protocol_post_task();
+#ifdef DEFERRED_EXEC_ENABLE
+    void deferred_exec_task(void);
+    deferred_exec_task();
+#endif
+    housekeeping_task();
+
+    uint64_t elapsed = cpu_time_ns() - start;
+    stats->total_ns += elapsed;
+    stats->max_ns = MAX(stats->max_ns, elapsed);
+    stats->scans++;
+}
+
+// Scans once per millisecond until the clock reaches the given time
+static void sim_run_until(uint32_t time, sim_stats_t *stats) {
+    while (timer_read32() < time) {
+        sim_scan(stats);
+        advance_time(1);
+    }
+}
+
+static bool sim_read_event(FILE *trace, unsigned long *line_number, uint32_t *time, uint8_t *row, uint8_t *col, bool *pressed) {
+    char line[128];
+    while (fgets(line, sizeof(line), trace)) {
+        unsigned long t, r, c, s;
+        char          extra;
+        (*line_number)++;
+
+        char *start = line + strspn(line, " \t\r\n");
+        if (*start == '\0' || *start == '#') {
+            continue;
+        }
+        if (sscanf(start, "%lu %lu %lu %lu %c", &t, &r, &c, &s, &extra) != 4 || r >= MATRIX_ROWS || c >= MATRIX_COLS || s > 1) {
+            fprintf(stderr, "trace:%lu: expected '<timestamp> <row> <col> <state>' within a %ux%u matrix\n", *line_number, MATRIX_ROWS, MATRIX_COLS);
+            exit(EXIT_FAILURE);
+        }
+        *time    = t;
+        *row     = r;
+        *col     = c;
+        *pressed = s;
+        return true;
+    }
+    return false;
+}
+
+int main(int argc, char **argv) {
+    FILE *trace = stdin;
+    if (argc > 2) {
+        fprintf(stderr, "usage: %s [trace]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc == 2 && strcmp(argv[1], "-") != 0) {
+        trace = fopen(argv[1], "r");
+        if (!trace) {
+            perror(argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    platform_setup();
+    protocol_setup();
+    keyboard_setup();
+
+    protocol_pre_init();
+    keyboard_init();
+    protocol_post_init();
+
+    set_time(0);
+
+    unsigned long line_number = 0;
+    uint32_t      time;
+    uint8_t       row, col;
+    bool          pressed;
+    bool          pending    = sim_read_event(trace, &line_number, &time, &row, &col, &pressed);
+    uint32_t      event_time = 0;
+    sim_stats_t   total      = {0};
+
+    // Idle scans before the first event don't count towards it
+    if (pending) {
+        sim_run_until(time, &total);
+    }
+
+    while (pending) {
+        if (time < event_time) {
+            fprintf(stderr, "trace:%lu: timestamp %" PRIu32 " goes back in time\n", line_number, time);
+            return EXIT_FAILURE;
+        }
+
+        if (pressed) {
+            sim_matrix[row] |= (matrix_row_t)1 << col;
+        } else {
+            sim_matrix[row] &= ~((matrix_row_t)1 << col);
+        }
+        sim_matrix_changed = true;
+
+        event_time            = time;
+        uint8_t event_row     = row;
+        uint8_t event_col     = col;
+        bool    event_pressed = pressed;
+
+        // An event is charged for everything the firmware does until the next one, such as
+        // debouncing it or resolving the tap-hold decisions it causes. Events sharing a
+        // timestamp are seen by the same scan, which is charged to the last of them.
+        sim_stats_t stats = {0};
+        pending           = sim_read_event(trace, &line_number, &time, &row, &col, &pressed);
+        sim_run_until(pending ? time : event_time + SIM_TRAILING_MS, &stats);
+
+        printf("%" PRIu32 " event %u %u %u cpu_ns=%" PRIu64 " max_scan_ns=%" PRIu64 " scans=%" PRIu32 "\n", event_time, event_row, event_col, event_pressed, stats.total_ns, stats.max_ns, stats.scans);
+        total.total_ns += stats.total_ns;
+        total.max_ns = MAX(total.max_ns, stats.max_ns);
+        total.scans += stats.scans;
+    }
+
+    printf("%" PRIu32 " total cpu_ns=%" PRIu64 " max_scan_ns=%" PRIu64 " scans=%" PRIu32 "\n", timer_read32(), total.total_ns, total.max_ns, total.scans);
+
+    if (trace != stdin) {
+        fclose(trace);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,8 @@
+SIM_DIR = protocol/sim
+
+SRC += $(SIM_DIR)/sim.c
+
+# Search Path
+VPATH += $(TMK_PATH)/$(SIM_DIR)
+
+OPT_DEFS += -DPROTOCOL_SIM
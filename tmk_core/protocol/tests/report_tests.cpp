@@ -0,0 +1,169 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "report.h"
+#include "keycode_config.h"
+#include "usb_device_state.h"
+
+static report_keyboard_t keyboard_report_storage;
+static report_nkro_t     nkro_report_storage;
+
+report_keyboard_t *keyboard_report = &keyboard_report_storage;
+report_nkro_t     *nkro_report     = &nkro_report_storage;
+keymap_config_t    keymap_config;
+
+static usb_hid_protocol_t protocol = USB_PROTOCOL_REPORT;
+
+usb_hid_protocol_t usb_device_state_get_protocol(void) {
+    return protocol;
+}
+}
+
+static bool nkro_active(void) {
+    return protocol == USB_PROTOCOL_REPORT && keymap_config.nkro;
+}
+
+// Scans of the reports, as the queries were implemented before the keys were tracked.
+// The exception is the NKRO key count, which used to be the number of non-empty bytes.
+static uint8_t reference_key_count(void) {
+    uint8_t count = 0;
+    if (nkro_active()) {
+        for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+            count += __builtin_popcount(nkro_report->bits[i]);
+        }
+    } else {
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            count += keyboard_report->keys[i] != 0;
+        }
+    }
+    return count;
+}
+
+static uint8_t reference_first_key(void) {
+    if (nkro_active()) {
+        uint8_t i = 0;
+        for (; i < NKRO_REPORT_BITS && !nkro_report->bits[i]; i++)
+            ;
+        return i < NKRO_REPORT_BITS ? i << 3 | (31 - __builtin_clz(nkro_report->bits[i])) : KC_NO;
+    }
+    return keyboard_report->keys[0];
+}
+
+static bool reference_is_key_pressed(uint8_t key) {
+    if (key == KC_NO) {
+        return false;
+    }
+    if (nkro_active()) {
+        return (key >> 3) < NKRO_REPORT_BITS && (nkro_report->bits[key >> 3] & 1 << (key & 7));
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keyboard_report->keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+class ReportTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        for (bool nkro : {false, true}) {
+            keymap_config.nkro = nkro;
+            clear_keys_from_report();
+        }
+        protocol = USB_PROTOCOL_REPORT;
+    }
+
+    void expect_matches_reference(const char *context) {
+        EXPECT_EQ(has_anykey(), reference_key_count()) << context;
+        EXPECT_EQ(get_first_key(), reference_first_key()) << context;
+        for (int key = 0; key <= 0xFF; key++) {
+            ASSERT_EQ(is_key_pressed(key), reference_is_key_pressed(key)) << context << ", key " << key;
+        }
+    }
+};
+
+TEST_F(ReportTest, EmptyReports) {
+    for (bool nkro : {false, true}) {
+        keymap_config.nkro = nkro;
+        EXPECT_EQ(has_anykey(), 0);
+        EXPECT_EQ(get_first_key(), KC_NO);
+        EXPECT_FALSE(is_key_pressed(KC_A));
+    }
+}
+
+TEST_F(ReportTest, NkroCountsKeysNotBytes) {
+    keymap_config.nkro = true;
+    add_key_to_report(KC_A);
+    add_key_to_report(KC_B);
+    add_key_to_report(KC_B);
+    add_key_to_report(KC_RIGHT_GUI);
+    EXPECT_EQ(has_anykey(), 3);
+    EXPECT_EQ(get_first_key(), KC_B);
+
+    del_key_from_report(KC_B);
+    del_key_from_report(KC_B);
+    EXPECT_EQ(has_anykey(), 2);
+    EXPECT_EQ(get_first_key(), KC_A);
+
+    // Keys past the end of the bitmap are ignored
+    add_key_to_report(0xFF);
+    EXPECT_EQ(has_anykey(), 2);
+}
+
+TEST_F(ReportTest, SixKroIgnoresKeysPastTheLimit) {
+    keymap_config.nkro = false;
+    for (uint8_t key = KC_A; key < KC_A + KEYBOARD_REPORT_KEYS + 2; key++) {
+        add_key_to_report(key);
+    }
+    EXPECT_EQ(has_anykey(), KEYBOARD_REPORT_KEYS);
+
+    del_key_from_report(KC_NO);
+    EXPECT_EQ(has_anykey(), KEYBOARD_REPORT_KEYS);
+    expect_matches_reference("full 6KRO report");
+}
+
+TEST_F(ReportTest, OtherReportsDontAffectTracking) {
+    report_keyboard_t keyboard = {};
+    report_nkro_t     nkro     = {};
+    add_key_byte(&keyboard, KC_A);
+    add_key_bit(&nkro, KC_A);
+
+    for (bool nkro_enabled : {false, true}) {
+        keymap_config.nkro = nkro_enabled;
+        EXPECT_EQ(has_anykey(), 0);
+    }
+}
+
+TEST_F(ReportTest, RandomMutationsMatchReference) {
+    std::mt19937 rng(48);
+
+    for (int step = 0; step < 20000; step++) {
+        std::string context = "step " + std::to_string(step);
+        uint32_t    action  = rng() % 100;
+        // Favour a small set of keys, so that deletions usually hit pressed ones
+        uint8_t key = rng() % 4 ? KC_A + rng() % 40 : rng() % 0x100;
+
+        if (action < 50) {
+            add_key_to_report(key);
+        } else if (action < 95) {
+            del_key_from_report(key);
+        } else if (action < 97) {
+            keymap_config.nkro = !keymap_config.nkro;
+        } else if (action < 99) {
+            protocol = protocol == USB_PROTOCOL_REPORT ? USB_PROTOCOL_BOOT : USB_PROTOCOL_REPORT;
+        } else {
+            clear_keys_from_report();
+        }
+
+        expect_matches_reference(context.c_str());
+        if (HasFatalFailure()) {
+            return;
+        }
+    }
+}
@@ -0,0 +1,11 @@
+report_DEFS := -DNKRO_ENABLE -DMOUSE_ENABLE -DNO_DEBUG -DEEPROM_TEST_HARNESS
+
+report_SRC := \
+    $(TMK_PATH)/protocol/tests/report_tests.cpp \
+    $(TMK_PATH)/protocol/tests/usb_report_queue_tests.cpp \
+    $(TMK_PATH)/protocol/report.c \
+    $(TMK_PATH)/protocol/usb_report_queue.c \
+    $(QUANTUM_PATH)/bitwise.c
+
+report_INC := \
+    $(TMK_PATH)/protocol
@@ -0,0 +1,123 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "report.h"
+#include "usb_report_queue.h"
+}
+
+// Reports held back while the endpoint queue is full, as with USB_ENDPOINT_IN_NONBLOCKING
+static uint8_t            held_data[16 * 4];
+static uint8_t            held_sizes[4];
+static usb_report_queue_t held = {held_data, held_sizes, 16, 4, 0, 0};
+
+static bool merge_mouse(uint8_t *into, const uint8_t *report, uint8_t size) {
+    EXPECT_EQ(size, sizeof(report_mouse_t));
+    return merge_mouse_report((report_mouse_t *)into, (const report_mouse_t *)report);
+}
+
+template <typename T>
+static T pop_report(void) {
+    uint8_t  size;
+    uint8_t *data = usb_report_queue_peek(&held, &size);
+    EXPECT_NE(data, nullptr);
+    EXPECT_EQ(size, sizeof(T));
+
+    T report = {};
+    if (data != nullptr) {
+        memcpy(&report, data, sizeof(T));
+        usb_report_queue_pop(&held);
+    }
+    return report;
+}
+
+class UsbReportQueueTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        usb_report_queue_clear(&held);
+    }
+};
+
+TEST_F(UsbReportQueueTest, TapWhileFullSendsPressAndRelease) {
+    report_keyboard_t press   = {.mods = 0, .reserved = 0, .keys = {KC_A}};
+    report_keyboard_t release = {};
+
+    EXPECT_TRUE(usb_report_queue_push(&held, (uint8_t *)&press, 8, NULL, true));
+    EXPECT_TRUE(usb_report_queue_push(&held, (uint8_t *)&release, 8, NULL, true));
+
+    EXPECT_EQ(pop_report<report_keyboard_t>().keys[0], KC_A);
+    EXPECT_EQ(pop_report<report_keyboard_t>().keys[0], KC_NO);
+    EXPECT_TRUE(usb_report_queue_is_empty(&held));
+}
+
+TEST_F(UsbReportQueueTest, FullQueueRefusesReports) {
+    report_keyboard_t report = {};
+
+    for (uint8_t i = 0; i < 4; i++) {
+        report.keys[0] = KC_A + i;
+        EXPECT_TRUE(usb_report_queue_push(&held, (uint8_t *)&report, 8, NULL, true));
+    }
+    EXPECT_TRUE(usb_report_queue_is_full(&held));
+    EXPECT_FALSE(usb_report_queue_push(&held, (uint8_t *)&report, 8, NULL, true));
+
+    // Wrapping around keeps the order
+    EXPECT_EQ(pop_report<report_keyboard_t>().keys[0], KC_A);
+    report.keys[0] = KC_E;
+    EXPECT_TRUE(usb_report_queue_push(&held, (uint8_t *)&report, 8, NULL, true));
+    for (uint8_t key = KC_B; key <= KC_E; key++) {
+        EXPECT_EQ(pop_report<report_keyboard_t>().keys[0], key);
+    }
+}
+
+TEST_F(UsbReportQueueTest, MouseMovementIsAddedUp) {
+    report_mouse_t move = {};
+    move.x              = 10;
+    move.y              = -3;
+
+    EXPECT_TRUE(usb_report_queue_push(&held, (uint8_t *)&move, sizeof(move), merge_mouse, true));
+    move.x = 5;
+    move.v = 1;
+    EXPECT_TRUE(usb_report_queue_push(&held, (uint8_t *)&move, sizeof(move), merge_mouse, true));
+
+    report_mouse_t sent = pop_report<report_mouse_t>();
+    EXPECT_EQ(sent.x, 15);
+    EXPECT_EQ(sent.y, -6);
+    EXPECT_EQ(sent.v, 1);
+    EXPECT_TRUE(usb_report_queue_is_empty(&held));
+}
+
+TEST_F(UsbReportQueueTest, MouseClickIsNotMerged) {
+    report_mouse_t report = {};
+
+    report.buttons = MOUSE_BTN1;
+    EXPECT_TRUE(usb_report_queue_push(&held, (uint8_t *)&report, sizeof(report), merge_mouse, true));
+    report.buttons = 0;
+    EXPECT_TRUE(usb_report_queue_push(&held, (uint8_t *)&report, sizeof(report), merge_mouse, true));
+
+    EXPECT_EQ(pop_report<report_mouse_t>().buttons, MOUSE_BTN1);
+    EXPECT_EQ(pop_report<report_mouse_t>().buttons, 0);
+}
+
+TEST_F(UsbReportQueueTest, MouseMovementOverflowIsNotMerged) {
+    report_mouse_t move = {};
+    move.x              = 100;
+
+    EXPECT_TRUE(usb_report_queue_push(&held, (uint8_t *)&move, sizeof(move), merge_mouse, true));
+    EXPECT_TRUE(usb_report_queue_push(&held, (uint8_t *)&move, sizeof(move), merge_mouse, true));
+
+    EXPECT_EQ(pop_report<report_mouse_t>().x, 100);
+    EXPECT_EQ(pop_report<report_mouse_t>().x, 100);
+}
+
+TEST_F(UsbReportQueueTest, ReportInFlightIsNotMerged) {
+    report_mouse_t move = {};
+    move.x              = 1;
+
+    EXPECT_TRUE(usb_report_queue_push(&held, (uint8_t *)&move, sizeof(move), merge_mouse, true));
+    EXPECT_TRUE(usb_report_queue_push(&held, (uint8_t *)&move, sizeof(move), merge_mouse, false));
+
+    EXPECT_EQ(pop_report<report_mouse_t>().x, 1);
+    EXPECT_EQ(pop_report<report_mouse_t>().x, 1);
+}
@@ -0,0 +1,61 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "usb_report_queue.h"
+
+static uint8_t usb_report_queue_slot(const usb_report_queue_t *queue, uint8_t index) {
+    return (queue->head + index) % queue->capacity;
+}
+
+void usb_report_queue_clear(usb_report_queue_t *queue) {
+    queue->head  = 0;
+    queue->count = 0;
+}
+
+bool usb_report_queue_is_empty(const usb_report_queue_t *queue) {
+    return queue->count == 0;
+}
+
+bool usb_report_queue_is_full(const usb_report_queue_t *queue) {
+    return queue->count == queue->capacity;
+}
+
+bool usb_report_queue_push(usb_report_queue_t *queue, const uint8_t *data, uint8_t size, usb_report_merge_t merge, bool merge_last) {
+    if (size > queue->slot_size) {
+        return false;
+    }
+
+    if (queue->count > 0 && merge != NULL && merge_last) {
+        uint8_t last = usb_report_queue_slot(queue, queue->count - 1);
+        if (queue->sizes[last] == size && merge(&queue->data[last * queue->slot_size], data, size)) {
+            return true;
+        }
+    }
+
+    if (usb_report_queue_is_full(queue)) {
+        return false;
+    }
+
+    uint8_t slot = usb_report_queue_slot(queue, queue->count);
+    memcpy(&queue->data[slot * queue->slot_size], data, size);
+    queue->sizes[slot] = size;
+    queue->count++;
+    return true;
+}
+
+uint8_t *usb_report_queue_peek(usb_report_queue_t *queue, uint8_t *size) {
+    if (queue->count == 0) {
+        return NULL;
+    }
+
+    *size = queue->sizes[queue->head];
+    return &queue->data[queue->head * queue->slot_size];
+}
+
+void usb_report_queue_pop(usb_report_queue_t *queue) {
+    if (queue->count > 0) {
+        queue->head = usb_report_queue_slot(queue, 1);
+        queue->count--;
+    }
+}
@@ -0,0 +1,54 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A small FIFO of reports held back while an endpoint is busy, sent in the order
+// they were queued. Reports are only ever combined through a merge callback,
+// which must refuse whenever combining them would hide a change from the host,
+// such as a key or button being pressed or released.
+
+typedef struct {
+    uint8_t *data;      // capacity slots of slot_size bytes
+    uint8_t *sizes;     // size of the report in each slot
+    uint8_t  slot_size; // largest report that fits, usually the endpoint size
+    uint8_t  capacity;
+    uint8_t  head;
+    uint8_t  count;
+} usb_report_queue_t;
+
+// Folds `report` into the last queued report `into`, both of `size` bytes.
+// Returns false if they have to be sent separately.
+typedef bool (*usb_report_merge_t)(uint8_t *into, const uint8_t *report, uint8_t size);
+
+#define USB_REPORT_QUEUE(slot_size_, capacity_)                            \
+    {                                                                      \
+        .data      = (_Alignas(4) uint8_t[(slot_size_) * (capacity_)]){0}, \
+        .sizes     = (uint8_t[(capacity_)]){0},                            \
+        .slot_size = (slot_size_),                                         \
+        .capacity  = (capacity_),                                          \
+    }
+
+void usb_report_queue_clear(usb_report_queue_t *queue);
+bool usb_report_queue_is_empty(const usb_report_queue_t *queue);
+bool usb_report_queue_is_full(const usb_report_queue_t *queue);
+
+// Queues a report, or merges it into the last one if `merge` is given and
+// `merge_last` allows it. Returns false if the queue is full.
+bool usb_report_queue_push(usb_report_queue_t *queue, const uint8_t *data, uint8_t size, usb_report_merge_t merge, bool merge_last);
+
+// Returns the oldest report and its size, or NULL if the queue is empty. It
+// stays in place until usb_report_queue_pop() is called.
+uint8_t *usb_report_queue_peek(usb_report_queue_t *queue, uint8_t *size);
+void     usb_report_queue_pop(usb_report_queue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
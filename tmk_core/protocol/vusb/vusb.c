@@ -41,7 +41,6 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #endif
 
 #if defined(CONSOLE_ENABLE)
-#    define RBUF_SIZE 128
 #    include "ring_buffer.h"
 #endif
 
@@ -179,8 +178,12 @@ void raw_hid_task(void) {
 #    define CONSOLE_BUFFER_SIZE 32
 #    define CONSOLE_EPSIZE 8
 
+RING_BUFFER_DEFINE(console_ring, uint8_t, 128);
+
+static console_ring_t console_buffer;
+
 int8_t sendchar(uint8_t c) {
-    rbuf_enqueue(c);
+    console_ring_push(&console_buffer, c);
     return 0;
 }
 
@@ -191,15 +194,10 @@ void console_task(void) {
         return;
     }
 
-    if (!rbuf_has_data()) {
-        return;
-    }
-
     // Send in chunks of 8 padded to 32
-    char    send_buf[CONSOLE_BUFFER_SIZE] = {0};
-    uint8_t send_buf_count                = 0;
-    while (rbuf_has_data() && send_buf_count < CONSOLE_EPSIZE) {
-        send_buf[send_buf_count++] = rbuf_dequeue();
+    uint8_t send_buf[CONSOLE_BUFFER_SIZE] = {0};
+    if (console_ring_pop_bulk(&console_buffer, send_buf, CONSOLE_EPSIZE) == 0) {
+        return;
     }
 
     send_report(3, send_buf, CONSOLE_BUFFER_SIZE);
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+"""Compares benchmark or cycle count results against a baseline.
+
+Both files are in the JSON format printed by `make bench` and by firmware built with the `cycles` target.
+Every per-operation metric, apart from the fastest run, is checked against the baseline, which can
+also be a hand-written budget. Exits with an error if any of them got slower than allowed.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_metrics(path):
+    with open(path) as f:
+        results = json.load(f)
+    metrics = {}
+    for benchmark in results['benchmarks']:
+        for key, value in benchmark.items():
+            if key.endswith('_per_op') and not key.startswith('min_'):
+                metrics[(benchmark['name'], key)] = value
+    return metrics
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('baseline', help='the reference results, or budgets')
+    parser.add_argument('results', help='the results to check')
+    parser.add_argument('-t', '--tolerance', type=float, default=5.0, help='how much slower than the baseline is allowed, in percent (default: %(default)s)')
+    args = parser.parse_args()
+
+    baseline = load_metrics(args.baseline)
+    results = load_metrics(args.results)
+
+    regressions = 0
+    for (name, key), value in sorted(results.items()):
+        if (name, key) not in baseline:
+            print(f'{name:40} {key:20} {value:12.2f}  (new)')
+            continue
+        reference = baseline[(name, key)]
+        delta = (value - reference) * 100 / reference if reference else 0.0
+        regressed = value > reference * (1 + args.tolerance / 100)
+        regressions += regressed
+        print(f'{name:40} {key:20} {value:12.2f}  {delta:+7.2f}%{"  REGRESSION" if regressed else ""}')
+
+    for name, key in sorted(baseline.keys() - results.keys()):
+        print(f'{name:40} {key:20} {"":12}  (missing)')
+
+    if regressions:
+        print(f'{regressions} metric(s) regressed by more than {args.tolerance}%', file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
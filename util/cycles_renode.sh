@@ -0,0 +1,71 @@
+#!/bin/bash
+
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Runs firmware built with the `cycles` target under Renode, and prints the
+# cycle counts it reports through semihosting.
+
+set -eEuo pipefail
+
+renode_bin="${RENODE:-renode}"
+timeout_secs=120
+unset platform
+
+function usage() {
+    echo "Usage: $(basename "$0") [-h] [-t <seconds>] -p <platform.repl> <firmware.elf>"
+    echo "    -h             : Shows this usage page."
+    echo "    -p <platform>  : The Renode platform description of the MCU, for example \`platforms/cpus/stm32f4.repl\`."
+    echo "    -t <seconds>   : Gives up after this long. Defaults to \`$timeout_secs\`."
+    echo "The Renode executable can be set with the RENODE environment variable."
+    exit 1
+}
+
+while getopts "hp:t:" opt "$@" ; do
+    case "$opt" in
+        h) usage; exit 0;;
+        p) platform="${OPTARG:-}";;
+        t) timeout_secs="${OPTARG:-}";;
+        \?) usage >&2; exit 1;;
+    esac
+done
+shift $((OPTIND-1))
+
+if [[ -z "${platform:-}" ]] || [[ ${#} -ne 1 ]]; then
+    usage >&2
+fi
+firmware=$(realpath "$1")
+
+work_dir=$(mktemp -d)
+trap 'rm -rf "$work_dir"' EXIT
+output="$work_dir/output.json"
+touch "$output"
+
+cat > "$work_dir/cycles.resc" <<RESC
+mach create "cycles"
+machine LoadPlatformDescription @$platform
+machine LoadPlatformDescriptionFromString "semihosting: UART.SemihostingUart @ cpu"
+semihosting CreateFileBackend @$output true
+sysbus LoadELF @$firmware
+start
+RESC
+
+"$renode_bin" --disable-xwt --console --plain -e "include @$work_dir/cycles.resc" >"$work_dir/renode.log" 2>&1 &
+renode_pid=$!
+
+# The firmware asks to exit once it's done, which Renode doesn't honour, so watch for the end of the report instead
+for (( i = 0; i < timeout_secs * 10; i++ )); do
+    if grep -q '^}$' "$output" || ! kill -0 $renode_pid 2>/dev/null; then
+        break
+    fi
+    sleep 0.1
+done
+kill $renode_pid 2>/dev/null || true
+wait $renode_pid 2>/dev/null || true
+
+if ! grep -q '^}$' "$output"; then
+    echo "The firmware didn't report its cycle counts, see the Renode log:" >&2
+    cat "$work_dir/renode.log" >&2
+    exit 1
+fi
+cat "$output"
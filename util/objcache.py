@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+"""Content-addressed object cache, used as a compiler prefix.
+
+Usage: objcache.py <compiler> <arguments>...
+
+Compilations are keyed on the preprocessed source, the remaining flags and the compiler itself, so that a
+translation unit built by several keyboards with the same effective defines is only compiled once. Line markers
+are left out of the key, as they name the per-target generated headers even when their contents are identical.
+So are defines and include paths, which only matter through the preprocessed source, and the names of assembler
+listings. Listings aren't written when an object comes from the cache.
+Anything other than the compilation of a single source file to an object is passed straight to the compiler.
+
+The cache lives in $QMK_OBJCACHE_DIR, and a line is appended to its stats file for every hit or miss.
+"""
+
+import hashlib
+import os
+import re
+import subprocess
+import sys
+
+# Flags only affecting dependency generation, along with how many arguments they take
+DEPENDENCY_FLAGS = {'-MD': 0, '-MMD': 0, '-MP': 0, '-MF': 1, '-MT': 1, '-MQ': 1}
+# Flags only affecting the preprocessed source, given either with their argument or followed by it
+PREPROCESSOR_FLAGS = ('-D', '-U', '-I', '-iquote', '-isystem', '-idirafter', '-include', '-imacros')
+SOURCE_SUFFIXES = ('.c', '.cpp', '.cc', '.S')
+
+# Assembler listing options, such as -adhlns=<file>, which name a file next to each target's object
+LISTING_RE = re.compile(r'(?<=,)(-a[a-z]*)=[^,]*')
+
+
+def parse(args):
+    """Returns the object file, the source file and the flags making up the key, or None if the command isn't cacheable.
+    """
+    output = None
+    sources = []
+    flags = []
+    compile_only = False
+    i = 0
+    while i < len(args):
+        arg = args[i]
+        if arg == '-c':
+            compile_only = True
+        elif arg in ('-E', '-S', '-v', '-H', '-'):
+            return None
+        elif arg == '-o' and i + 1 < len(args):
+            output = args[i + 1]
+            i += 1
+        elif arg in DEPENDENCY_FLAGS:
+            i += DEPENDENCY_FLAGS[arg]
+        elif arg in PREPROCESSOR_FLAGS:
+            i += 1
+        elif arg.startswith(PREPROCESSOR_FLAGS):
+            pass
+        elif not arg.startswith('-') and arg.endswith(SOURCE_SUFFIXES) and not (flags and flags[-1] == '-x'):
+            sources.append(arg)
+        elif arg.startswith('-Wa,'):
+            flags.append(LISTING_RE.sub(r'\1', arg))
+        else:
+            flags.append(arg)
+        i += 1
+
+    if not compile_only or output is None or not output.endswith('.o') or len(sources) != 1:
+        return None
+    return output, sources[0], flags
+
+
+def compiler_identity(compiler):
+    """Identifies the compiler by its location and modification time, which is much cheaper than asking for its version.
+    """
+    for directory in os.environ.get('PATH', '').split(os.pathsep):
+        path = os.path.join(directory, compiler)
+        if os.path.isfile(path) and os.access(path, os.X_OK):
+            stat = os.stat(path)
+            return f'{os.path.realpath(path)}:{stat.st_size}:{stat.st_mtime_ns}'
+    return compiler
+
+
+def preprocess(compiler, args, output):
+    """Runs the preprocessor in place of the compilation, leaving the dependency file where the compiler would have.
+    """
+    command = [compiler]
+    i = 0
+    while i < len(args):
+        if args[i] == '-c':
+            command.append('-E')
+        elif args[i] == '-o':
+            command.extend(['-o', '-', '-MT', output])
+            i += 1
+        else:
+            command.append(args[i])
+        i += 1
+    command.append('-P')
+
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+    return result.stdout if result.returncode == 0 else None
+
+
+def write_atomic(path, data):
+    temp = f'{path}.{os.getpid()}.tmp'
+    with open(temp, 'wb') as f:
+        f.write(data)
+    os.replace(temp, path)
+
+
+def record(cache_dir, outcome, source):
+    with open(os.path.join(cache_dir, 'stats'), 'a') as f:
+        f.write(f'{outcome} {source}\n')
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__.splitlines()[2], file=sys.stderr)
+        return 1
+
+    compiler, args = sys.argv[1], sys.argv[2:]
+    cache_dir = os.environ.get('QMK_OBJCACHE_DIR')
+    parsed = parse(args)
+    if not cache_dir or not parsed:
+        os.execvp(compiler, [compiler, *args])
+
+    output, source, flags = parsed
+    preprocessed = preprocess(compiler, args, output)
+    if preprocessed is None:
+        # Let the compiler report whatever went wrong
+        os.execvp(compiler, [compiler, *args])
+
+    key = hashlib.sha256()
+    key.update(compiler_identity(compiler).encode())
+    key.update(b'\0'.join(flag.encode() for flag in flags))
+    key.update(b'\0')
+    key.update(preprocessed)
+    digest = key.hexdigest()
+
+    entry = os.path.join(cache_dir, digest[:2], digest)
+    try:
+        with open(f'{entry}.o', 'rb') as f:
+            obj = f.read()
+        with open(f'{entry}.log', 'rb') as f:
+            log = f.read()
+    except FileNotFoundError:
+        pass
+    else:
+        write_atomic(output, obj)
+        # Warnings are replayed, so that a cached build reports the same as a fresh one
+        sys.stderr.buffer.write(log)
+        record(cache_dir, 'hit', source)
+        return 0
+
+    result = subprocess.run([compiler, *args], stderr=subprocess.PIPE)
+    sys.stderr.buffer.write(result.stderr)
+    if result.returncode != 0:
+        return result.returncode
+
+    os.makedirs(os.path.dirname(entry), exist_ok=True)
+    with open(output, 'rb') as f:
+        write_atomic(f'{entry}.o', f.read())
+    write_atomic(f'{entry}.log', result.stderr)
+    record(cache_dir, 'miss', source)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())